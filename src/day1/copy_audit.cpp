@@ -0,0 +1,126 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "counting_probe.hpp"
+
+// 拷贝审计：rvo_nrvo / rule_of_five 里靠肉眼看打印，这里把同样的场景写成计数断言，
+// 任何一条不满足就打印计数并以非 0 退出，拷贝回归能直接让检查失败
+
+struct Tag {}; // 和其它用例隔开计数
+using Str = day1::CountingProbe<std::string, Tag>;
+using Scope = day1::ProbeScope<std::string, Tag>;
+
+// 移动可能抛异常的类型：vector 扩容时只能退回拷贝
+struct ThrowingMove {
+    std::string s;
+    ThrowingMove() = default;
+    explicit ThrowingMove(std::string v) : s(std::move(v)) {}
+    ThrowingMove(const ThrowingMove&) = default;
+    ThrowingMove(ThrowingMove &&o) noexcept(false) : s(std::move(o.s)) {}
+    ThrowingMove &operator=(const ThrowingMove&) = default;
+    ThrowingMove &operator=(ThrowingMove&&) = default;
+};
+using Risky = day1::CountingProbe<ThrowingMove>;
+
+static Str make_prvalue() { return Str("rvo"); }
+
+static Str make_named() {
+    Str s("nrvo");
+    s->append("!");
+    return s;
+}
+
+static std::size_t by_value(Str s) { return s->size(); }
+static std::size_t by_cref(const Str &s) { return s->size(); }
+
+static int failures = 0;
+
+static void check(bool cond, const char *what, const day1::CopyStats &d) {
+    if (!day1::expect(cond, what, d)) ++failures;
+    else std::cout << "[ OK ] " << what << "\n";
+}
+
+int main() {
+    static_assert(std::is_nothrow_move_constructible_v<Str>, "Probe 的移动应与 std::string 一样 noexcept");
+    static_assert(!std::is_nothrow_move_constructible_v<Risky>, "Probe 的移动应与 T 一样可能抛异常");
+    static_assert(!std::is_copy_constructible_v<day1::CountingProbe<std::unique_ptr<int>>>,
+                  "T 不可拷贝时 Probe 也不可拷贝");
+
+    {
+        Scope scope;
+        auto a = make_prvalue();
+        auto b = make_named();
+        auto d = scope.delta();
+        check(d.copies() == 0 && d.moves() == 0, "RVO/NRVO 不产生拷贝和移动", d);
+    }
+
+    {
+        Scope scope;
+        std::vector<Str> v;
+        v.reserve(3);
+        v.push_back(Str("a"));
+        v.emplace_back("b");
+        auto d = scope.delta();
+        check(d.copies() == 0 && d.move_ctor == 1, "push_back(prvalue) 移动一次，emplace_back 原地构造", d);
+    }
+
+    {
+        Str s(std::string(1000, 'x'));
+        Scope scope;
+        by_cref(s);
+        auto d = scope.delta();
+        check(d.copies() == 0, "const& 传参不拷贝", d);
+
+        scope.restart();
+        by_value(s);
+        d = scope.delta();
+        check(d.copy_ctor == 1 && d.bytes_copied >= 1000, "按值传左值拷贝一次，字节数计入字符串内容", d);
+
+        scope.restart();
+        by_value(std::move(s));
+        d = scope.delta();
+        check(d.copies() == 0 && d.move_ctor == 1, "按值传 std::move 只移动", d);
+    }
+
+    {
+        const Str c("const");
+        Scope scope;
+        Str moved = std::move(c); // const 对象上的 std::move 静默退化为拷贝
+        auto d = scope.delta();
+        check(d.copy_ctor == 1 && d.moves() == 0, "std::move(const) 实际是拷贝", d);
+    }
+
+    {
+        std::vector<Str> v;
+        Scope scope;
+        for (int i = 0; i < 100; ++i) v.emplace_back("item");
+        auto d = scope.delta();
+        check(d.copies() == 0, "noexcept 移动：vector 扩容只移动", d);
+    }
+
+    {
+        std::vector<Risky> v;
+        day1::ProbeScope<ThrowingMove> scope;
+        for (int i = 0; i < 100; ++i) v.emplace_back(std::string("item"));
+        auto d = scope.delta();
+        check(d.copies() > 0 && d.move_ctor == 0, "移动可能抛异常：vector 扩容退回拷贝", d);
+    }
+
+    {
+        Scope scope;
+        {
+            std::vector<Str> v(10, Str("fill"));
+            std::vector<Str> w = v;
+        }
+        auto d = scope.delta();
+        check(d.copy_ctor == 20 && d.alive() == 0, "填充 10 个 + 整体拷贝 10 个，全部析构", d);
+    }
+
+    std::cout << "total for std::string probes: " << day1::probe_stats<std::string, Tag>() << "\n";
+    if (failures) std::cerr << failures << " check(s) failed\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// CountingProbe：统计拷贝 / 移动 / 构造次数和拷贝字节数，取代到处 std::cout 的 Tracer
+// 典型用法：
+//   using Probe = day1::CountingProbe<std::string>;
+//   day1::ProbeScope<std::string> scope;                 // 记下当前计数
+//   std::vector<Probe> v;
+//   v.push_back(Probe("hello"));
+//   auto d = scope.delta();                              // 这段代码里发生了什么
+//   day1::expect(d.copies() == 0, "push_back(prvalue) 不应拷贝", d);
+//
+// 设计要点：
+// - 计数按 (T, Tag) 全局累计，用 relaxed 原子量，多线程里用也安全；Tag 默认就是 T，
+//   同一个 T 想分开统计时换一个 Tag
+// - 包装后的类型保持 T 的特殊成员语义：T 不可拷贝则 Probe 也不可拷贝，
+//   移动的 noexcept 与 T 一致（vector 扩容时选拷贝还是移动不受影响）
+// - 拷贝字节数：sizeof(T)，连续容器（有 data()/size()）再加上元素占的字节，
+//   用来发现“看似便宜”的大对象拷贝
+// - 不打印任何东西；ProbeScope 取差值，expect 在不满足时打印计数并返回 false，
+//   示例程序据此返回非 0 退出码，拷贝回归可以直接让检查失败
+
+namespace day1 {
+
+struct CopyStats {
+    std::uint64_t default_ctor = 0;
+    std::uint64_t value_ctor = 0;    // 从 T 或构造参数构造
+    std::uint64_t copy_ctor = 0;
+    std::uint64_t move_ctor = 0;
+    std::uint64_t copy_assign = 0;
+    std::uint64_t move_assign = 0;
+    std::uint64_t dtor = 0;
+    std::uint64_t bytes_copied = 0;
+
+    std::uint64_t copies() const noexcept { return copy_ctor + copy_assign; }
+    std::uint64_t moves() const noexcept { return move_ctor + move_assign; }
+    std::uint64_t constructions() const noexcept {
+        return default_ctor + value_ctor + copy_ctor + move_ctor;
+    }
+    // 仍然存活的对象数（差值里即这段代码净增的对象）
+    std::int64_t alive() const noexcept {
+        return static_cast<std::int64_t>(constructions()) - static_cast<std::int64_t>(dtor);
+    }
+
+    CopyStats operator-(const CopyStats &o) const noexcept {
+        return CopyStats{default_ctor - o.default_ctor, value_ctor - o.value_ctor,
+                         copy_ctor - o.copy_ctor, move_ctor - o.move_ctor,
+                         copy_assign - o.copy_assign, move_assign - o.move_assign,
+                         dtor - o.dtor, bytes_copied - o.bytes_copied};
+    }
+};
+
+inline std::ostream &operator<<(std::ostream &os, const CopyStats &s) {
+    return os << "ctor=" << s.default_ctor << "+" << s.value_ctor
+              << " copy=" << s.copy_ctor << "+" << s.copy_assign << "(assign)"
+              << " move=" << s.move_ctor << "+" << s.move_assign << "(assign)"
+              << " dtor=" << s.dtor << " bytes_copied=" << s.bytes_copied;
+}
+
+namespace probe_detail {
+
+struct Counters {
+    std::atomic<std::uint64_t> default_ctor{0}, value_ctor{0}, copy_ctor{0}, move_ctor{0},
+                               copy_assign{0}, move_assign{0}, dtor{0}, bytes_copied{0};
+
+    static void bump(std::atomic<std::uint64_t> &c, std::uint64_t n = 1) noexcept {
+        c.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    CopyStats snapshot() const noexcept {
+        auto ld = [](const std::atomic<std::uint64_t> &c) { return c.load(std::memory_order_relaxed); };
+        return CopyStats{ld(default_ctor), ld(value_ctor), ld(copy_ctor), ld(move_ctor),
+                         ld(copy_assign), ld(move_assign), ld(dtor), ld(bytes_copied)};
+    }
+
+    void reset() noexcept {
+        for (auto *c : {&default_ctor, &value_ctor, &copy_ctor, &move_ctor,
+                        &copy_assign, &move_assign, &dtor, &bytes_copied}) {
+            c->store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+template <class T, class Tag>
+Counters &counters() noexcept {
+    static Counters c;
+    return c;
+}
+
+template <class T, class = void>
+struct is_contiguous : std::false_type {};
+
+template <class T>
+struct is_contiguous<T, std::void_t<decltype(std::declval<const T&>().data()),
+                                    decltype(std::declval<const T&>().size()),
+                                    typename T::value_type>> : std::true_type {};
+
+template <class T>
+std::uint64_t copy_bytes(const T &v) noexcept {
+    if constexpr (is_contiguous<T>::value) {
+        return sizeof(T) + static_cast<std::uint64_t>(v.size()) * sizeof(typename T::value_type);
+    } else {
+        (void)v;
+        return sizeof(T);
+    }
+}
+
+// 计数放在基类的特殊成员里，CountingProbe 自己的特殊成员全部 = default：
+// T 的拷贝/移动被删除时 Probe 的也随之被删除，noexcept 也由 T 决定。
+// 基类拷贝构造时源对象已完整，可以通过 Derived 读到源的值来算拷贝字节数
+template <class Derived, class T, class Tag>
+struct ProbeHooks {
+    ProbeHooks() noexcept = default;
+
+    ProbeHooks(const ProbeHooks &o) noexcept { on_copy(c().copy_ctor, o); }
+    ProbeHooks(ProbeHooks&&) noexcept { Counters::bump(c().move_ctor); }
+
+    ProbeHooks &operator=(const ProbeHooks &o) noexcept {
+        on_copy(c().copy_assign, o);
+        return *this;
+    }
+
+    ProbeHooks &operator=(ProbeHooks&&) noexcept {
+        Counters::bump(c().move_assign);
+        return *this;
+    }
+
+    ~ProbeHooks() { Counters::bump(c().dtor); }
+
+    static Counters &c() noexcept { return counters<T, Tag>(); }
+
+private:
+    static void on_copy(std::atomic<std::uint64_t> &kind, const ProbeHooks &from) noexcept {
+        Counters::bump(kind);
+        Counters::bump(c().bytes_copied, copy_bytes(static_cast<const Derived &>(from).get()));
+    }
+};
+
+} // namespace probe_detail
+
+template <class T, class Tag = T>
+CopyStats probe_stats() noexcept { return probe_detail::counters<T, Tag>().snapshot(); }
+
+template <class T, class Tag = T>
+void probe_reset() noexcept { probe_detail::counters<T, Tag>().reset(); }
+
+template <class T, class Tag = T>
+class CountingProbe : private probe_detail::ProbeHooks<CountingProbe<T, Tag>, T, Tag> {
+    using Hooks = probe_detail::ProbeHooks<CountingProbe<T, Tag>, T, Tag>;
+    friend Hooks;
+
+public:
+    using value_type = T;
+
+    CountingProbe() noexcept(std::is_nothrow_default_constructible_v<T>) : value_() {
+        probe_detail::Counters::bump(Hooks::c().default_ctor);
+    }
+
+    // 从 T 的构造参数原地构造；拷贝/移动 Probe 本身走下面默认生成的特殊成员
+    template <class... Args,
+              class = std::enable_if_t<std::is_constructible_v<T, Args&&...> &&
+                                       !(sizeof...(Args) == 1 &&
+                                         (std::is_same_v<std::decay_t<Args>, CountingProbe> || ...))>>
+    explicit CountingProbe(Args&&... args) : value_(std::forward<Args>(args)...) {
+        probe_detail::Counters::bump(Hooks::c().value_ctor);
+    }
+
+    CountingProbe(const CountingProbe&) = default;
+    CountingProbe(CountingProbe&&) = default;
+    CountingProbe &operator=(const CountingProbe&) = default;
+    CountingProbe &operator=(CountingProbe&&) = default;
+    ~CountingProbe() = default;
+
+    T &get() noexcept { return value_; }
+    const T &get() const noexcept { return value_; }
+    T &operator*() noexcept { return value_; }
+    const T &operator*() const noexcept { return value_; }
+    T *operator->() noexcept { return &value_; }
+    const T *operator->() const noexcept { return &value_; }
+
+    friend bool operator==(const CountingProbe &a, const CountingProbe &b) { return a.value_ == b.value_; }
+    friend bool operator!=(const CountingProbe &a, const CountingProbe &b) { return !(a == b); }
+    friend bool operator<(const CountingProbe &a, const CountingProbe &b) { return a.value_ < b.value_; }
+
+private:
+    T value_;
+};
+
+// 记下构造时的计数，delta() 返回之后发生的部分
+template <class T, class Tag = T>
+class ProbeScope {
+public:
+    ProbeScope() noexcept : start_(probe_stats<T, Tag>()) {}
+    CopyStats delta() const noexcept { return probe_stats<T, Tag>() - start_; }
+    void restart() noexcept { start_ = probe_stats<T, Tag>(); }
+
+private:
+    CopyStats start_;
+};
+
+// 检查失败时打印说明和计数，返回 cond 本身；示例程序累计失败数作为退出码
+inline bool expect(bool cond, const std::string &what, const CopyStats &d) {
+    if (!cond) std::cerr << "[FAIL] " << what << "\n       " << d << "\n";
+    return cond;
+}
+
+} // namespace day1
+
+template <class T, class Tag>
+struct std::hash<day1::CountingProbe<T, Tag>> {
+    std::size_t operator()(const day1::CountingProbe<T, Tag> &p) const { return std::hash<T>{}(p.get()); }
+};
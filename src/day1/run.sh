@@ -7,11 +7,12 @@ SRC_DIR="${SCRIPT_DIR}"
 
 usage() {
   cat <<'EOF'
-用法: ./run.sh [value|rvo|fwd|rule5|all]
+用法: ./run.sh [value|rvo|fwd|rule5|copy|all]
   value  编译运行 value_categories 示例
   rvo    编译运行 rvo_nrvo 示例
   fwd    编译运行 forwarding 示例（转发引用/引用折叠）
   rule5  编译运行 rule_of_five 示例（Rule of Five/Six）
+  copy   编译运行 copy_audit 示例（CountingProbe 拷贝/移动计数断言，失败返回非 0）
   all    编译运行全部示例（默认）
 EOF
 }
@@ -44,13 +45,19 @@ run_rule5() {
   echo "[RUN ] rule_of_five" && "${BUILD_DIR}/rule_of_five"
 }
 
+run_copy() {
+  build "copy_audit" "copy_audit.cpp"
+  echo "[RUN ] copy_audit" && "${BUILD_DIR}/copy_audit"
+}
+
 choice=${1:-all}
 case "${choice}" in
   value) run_value ;;
   rvo)   run_rvo ;;
   fwd)   run_fwd ;;
   rule5) run_rule5 ;;
-  all)   run_value; echo; run_rvo; echo; run_fwd; echo; run_rule5 ;;
+  copy)  run_copy ;;
+  all)   run_value; echo; run_rvo; echo; run_fwd; echo; run_rule5; echo; run_copy ;;
   -h|--help) usage ;;
   *) usage; exit 1 ;;
 esac
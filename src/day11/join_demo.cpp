@@ -0,0 +1,84 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "string_builder.hpp"
+
+// 统计全局堆分配次数：替换全局 operator new/delete（仅本示例）
+static std::atomic<long> g_allocs{0};
+
+void *operator new(std::size_t n) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+using Clock = std::chrono::steady_clock;
+
+// training/test1.cpp 原来的 join_strings：反复 +=
+static std::string join_append(const std::vector<std::string> &v, const std::string &sep) {
+    std::string ans;
+    if (v.empty()) return ans;
+    std::size_t n = v.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        ans += v[i];
+        if (i < n - 1) ans += sep;
+    }
+    return ans;
+}
+
+template <class F>
+static void measure(const char *name, int reps, F f) {
+    long allocs = g_allocs.load();
+    std::size_t bytes = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; ++r) bytes += f();
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / reps;
+    std::cout << "  " << name << ": " << us << " us/op, "
+              << static_cast<double>(g_allocs.load() - allocs) / reps << " allocs/op"
+              << (bytes ? "" : " (empty)") << "\n";
+}
+
+int main() {
+    std::vector<std::string> batch;
+    for (int i = 0; i < 100000; ++i) batch.push_back("order-" + std::to_string(i * 7919));
+
+    std::cout << "== 拼接 100k 个元素 ==\n";
+    measure("+= (test1)   ", 20, [&]{ return join_append(batch, ", ").size(); });
+    measure("day11::join  ", 20, [&]{ return day11::join(batch, ", ").size(); });
+
+    std::cout << "\n== 构造响应头：std::string vs StringBuilder<256> ==\n";
+    const int reps = 200000;
+    measure("std::string  ", reps, [&]{
+        std::string s;
+        s += "HTTP/1.1 ";
+        s += std::to_string(200);
+        s += " OK\r\nContent-Type: application/json\r\nContent-Length: ";
+        s += std::to_string(1234);
+        s += "\r\nX-Request-Id: 3f2a9c7e-41d0-4b8a\r\n\r\n";
+        return s.size();
+    });
+    day11::StringBuilder<> sb;
+    measure("StringBuilder", reps, [&]{
+        sb.clear();
+        sb << "HTTP/1.1 " << 200 << " OK\r\nContent-Type: application/json\r\nContent-Length: "
+           << 1234 << "\r\nX-Request-Id: 3f2a9c7e-41d0-4b8a\r\n\r\n";
+        return sb.size();
+    });
+    std::cout << sb.view();
+
+    day11::StringBuilder<16> small;
+    const std::string_view parts[] = {"a", "b", "c"};
+    small << "pi=" << 3.14159 << " ok=" << true << " parts=";
+    small.append_joined(parts, "|");
+    std::cout << small.view() << " (on_heap=" << small.on_heap() << ")\n";
+    return 0;
+}
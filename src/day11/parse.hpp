@@ -0,0 +1,223 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+// 不分配内存、与 locale 无关的 string_view 解析：bool / 整数 / 浮点数
+// 典型用法：
+//   auto on   = day11::parse_bool("TRUE");              // optional<bool>，大小写不敏感
+//   auto port = day11::parse_as<std::uint16_t>("8080");  // optional<uint16_t>，越界/非法返回 nullopt
+//   int n;
+//   if (auto ec = day11::parse("-42", n); ec != std::errc{}) { ...invalid_argument / result_out_of_range... }
+//
+// 设计要点：
+// - 错误码沿用 std::from_chars 的约定：std::errc::invalid_argument（格式不对）、
+//   std::errc::result_out_of_range（超出目标类型）；optional 版本只是把两者都折成 nullopt
+// - 必须整串匹配："12a"、" 12"、"" 都是 invalid_argument；允许一个前导 '+'（配置文件里常见）
+// - 整数用 SWAR：一次读 8 个字节，先用位运算判断是否全是数字，再用 3 次乘法把 8 位数字合成一个数，
+//   最多 19 位走快路径，第 20 位用溢出检测补上
+// - 浮点数交给 std::from_chars（最短往返、不看 locale），这里只补整串匹配和前导 '+'
+// - bool 接受 true/false/1/0/yes/no/on/off（大小写不敏感）：按长度分派后把几个字节拼成整数，
+//   或上 0x20 统一成小写，一次比较
+
+namespace day11 {
+
+namespace detail {
+
+// 小端读取 8 字节
+inline std::uint64_t load8(const char *p) noexcept {
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+// 8 个字节是否全是 '0'..'9'
+inline bool all_digits8(std::uint64_t v) noexcept {
+    return (((v & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+// 8 位十进制数字 -> 整数（首字符在最低字节）
+inline std::uint32_t parse8(std::uint64_t v) noexcept {
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);                                      // 相邻两位 -> 两位数
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return static_cast<std::uint32_t>(v);
+}
+
+// 纯数字串 -> uint64；非数字返回 invalid_argument，超过 uint64 返回 result_out_of_range
+inline std::errc parse_digits(std::string_view s, std::uint64_t &out) noexcept {
+    if (s.empty()) return std::errc::invalid_argument;
+    const char *p = s.data();
+    std::size_t n = s.size();
+    // 前导 0 不影响数值，先去掉，剩下的位数决定走不走溢出检测
+    while (n > 1 && *p == '0') {
+        ++p;
+        --n;
+    }
+    std::uint64_t v = 0;
+    std::size_t fast = n < 19 ? n : 19;   // 19 位十进制一定放得下 uint64
+    std::size_t i = 0;
+    for (; i + 8 <= fast; i += 8) {
+        auto chunk = load8(p + i);
+        if (!all_digits8(chunk)) return std::errc::invalid_argument;
+        v = v * 100000000ULL + parse8(chunk);
+    }
+    for (; i < fast; ++i) {
+        unsigned d = static_cast<unsigned char>(p[i]) - '0';
+        if (d > 9) return std::errc::invalid_argument;
+        v = v * 10 + d;
+    }
+    for (; i < n; ++i) {
+        unsigned d = static_cast<unsigned char>(p[i]) - '0';
+        if (d > 9) return std::errc::invalid_argument;
+        if (i >= 20 || __builtin_mul_overflow(v, 10u, &v) || __builtin_add_overflow(v, d, &v)) {
+            // 继续扫完：非数字优先报 invalid_argument
+            for (++i; i < n; ++i) {
+                if (static_cast<unsigned>(static_cast<unsigned char>(p[i]) - '0') > 9) {
+                    return std::errc::invalid_argument;
+                }
+            }
+            return std::errc::result_out_of_range;
+        }
+    }
+    out = v;
+    return std::errc{};
+}
+
+inline char lower(char c) noexcept { return static_cast<char>(c | 0x20); }
+
+// 把 n(<=8) 个字节拼成整数并统一成小写（对字母有效；数字 '0'/'1' 本身 bit5 已置位）
+inline std::uint64_t pack_lower(std::string_view s) noexcept {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        v |= static_cast<std::uint64_t>(static_cast<unsigned char>(lower(s[i]))) << (8 * i);
+    }
+    return v;
+}
+
+constexpr std::uint64_t pack(std::string_view s) noexcept {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        v |= static_cast<std::uint64_t>(static_cast<unsigned char>(s[i])) << (8 * i);
+    }
+    return v;
+}
+
+} // namespace detail
+
+// ---- bool ----
+
+inline std::errc parse(std::string_view s, bool &out) noexcept {
+    using detail::pack;
+    // 或 0x20 只对字母是“转小写”，其它字节（如 '\x10' -> '0'）会被误转，先挡掉
+    for (char c : s) {
+        bool alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '0' || c == '1';
+        if (!alnum) return std::errc::invalid_argument;
+    }
+    auto v = s.size() <= 8 ? detail::pack_lower(s) : 0;
+    switch (s.size()) {
+    case 1:
+        if (v == pack("1")) { out = true; return std::errc{}; }
+        if (v == pack("0")) { out = false; return std::errc{}; }
+        break;
+    case 2:
+        if (v == pack("on")) { out = true; return std::errc{}; }
+        if (v == pack("no")) { out = false; return std::errc{}; }
+        break;
+    case 3:
+        if (v == pack("yes")) { out = true; return std::errc{}; }
+        if (v == pack("off")) { out = false; return std::errc{}; }
+        break;
+    case 4:
+        if (v == pack("true")) { out = true; return std::errc{}; }
+        break;
+    case 5:
+        if (v == pack("false")) { out = false; return std::errc{}; }
+        break;
+    default:
+        break;
+    }
+    return std::errc::invalid_argument;
+}
+
+// training/test1.cpp 的签名；现在大小写不敏感，并多认 yes/no/on/off
+inline std::optional<bool> parse_bool(std::string_view s) noexcept {
+    bool b;
+    if (parse(s, b) != std::errc{}) return std::nullopt;
+    return b;
+}
+
+// ---- 整数 ----
+
+template <class Int, std::enable_if_t<std::is_integral_v<Int> && !std::is_same_v<Int, bool>, int> = 0>
+std::errc parse(std::string_view s, Int &out) noexcept {
+    bool neg = false;
+    if (!s.empty() && (s[0] == '-' || s[0] == '+')) {
+        neg = s[0] == '-';
+        s.remove_prefix(1);
+        if (neg && std::is_unsigned_v<Int>) {
+            // "-0" 仍然合法，其它负数超出范围
+            std::uint64_t mag;
+            auto ec = detail::parse_digits(s, mag);
+            if (ec != std::errc{}) return ec;
+            if (mag != 0) return std::errc::result_out_of_range;
+            out = 0;
+            return std::errc{};
+        }
+    }
+    std::uint64_t mag;
+    auto ec = detail::parse_digits(s, mag);
+    if (ec != std::errc{}) return ec;
+
+    using U = std::make_unsigned_t<Int>;
+    const std::uint64_t max_pos = static_cast<std::uint64_t>(std::numeric_limits<Int>::max());
+    if (!neg) {
+        if (mag > max_pos) return std::errc::result_out_of_range;
+        out = static_cast<Int>(mag);
+    } else {
+        // |min| = max + 1
+        if (mag > max_pos + 1) return std::errc::result_out_of_range;
+        out = static_cast<Int>(static_cast<U>(0) - static_cast<U>(mag));
+    }
+    return std::errc{};
+}
+
+// ---- 浮点数 ----
+
+template <class Float, std::enable_if_t<std::is_floating_point_v<Float>, int> = 0>
+std::errc parse(std::string_view s, Float &out) noexcept {
+    if (!s.empty() && s[0] == '+') {
+        s.remove_prefix(1);
+        if (!s.empty() && s[0] == '-') return std::errc::invalid_argument; // "+-1"
+    }
+    if (s.empty()) return std::errc::invalid_argument;
+    Float v;
+    auto r = std::from_chars(s.data(), s.data() + s.size(), v);
+    if (r.ec != std::errc{}) return r.ec;
+    if (r.ptr != s.data() + s.size()) return std::errc::invalid_argument;
+    out = v;
+    return std::errc{};
+}
+
+// 统一的 optional 版本：任何错误都返回 nullopt
+template <class T>
+std::optional<T> parse_as(std::string_view s) noexcept {
+    T v{};
+    if (parse(s, v) != std::errc{}) return std::nullopt;
+    return v;
+}
+
+} // namespace day11
@@ -0,0 +1,93 @@
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "parse.hpp"
+
+// 100 万个整数 / 浮点数字符串，对比 std::stoll、istringstream、std::from_chars 与 day11::parse
+using Clock = std::chrono::steady_clock;
+
+template <class F>
+static void measure(const char *name, std::size_t n, F f) {
+    auto t0 = Clock::now();
+    auto sum = f();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / static_cast<double>(n);
+    std::cout << "  " << name << ": " << ns << " ns/op (checksum " << sum << ")\n";
+}
+
+int main() {
+    std::mt19937_64 rng(11);
+    std::vector<std::string> ints, floats;
+    for (int i = 0; i < 1000000; ++i) {
+        auto v = static_cast<std::int64_t>(rng() >> (rng() % 64));
+        ints.push_back(std::to_string(i % 2 ? v : -v));
+        floats.push_back(std::to_string(static_cast<double>(rng() % 1000000) / 997.0));
+    }
+
+    std::cout << "== int64 ==\n";
+    measure("std::stoll     ", ints.size(), [&]{
+        std::int64_t s = 0;
+        for (auto &x : ints) s += std::stoll(x);
+        return s;
+    });
+    measure("istringstream  ", ints.size(), [&]{
+        std::int64_t s = 0;
+        for (auto &x : ints) {
+            std::istringstream in(x);
+            std::int64_t v = 0;
+            in >> v;
+            s += v;
+        }
+        return s;
+    });
+    measure("std::from_chars", ints.size(), [&]{
+        std::int64_t s = 0;
+        for (auto &x : ints) {
+            std::int64_t v = 0;
+            std::from_chars(x.data(), x.data() + x.size(), v);
+            s += v;
+        }
+        return s;
+    });
+    measure("day11::parse   ", ints.size(), [&]{
+        std::int64_t s = 0;
+        for (auto &x : ints) {
+            std::int64_t v = 0;
+            day11::parse(x, v);
+            s += v;
+        }
+        return s;
+    });
+
+    std::cout << "\n== double ==\n";
+    measure("std::stod      ", floats.size(), [&]{
+        double s = 0;
+        for (auto &x : floats) s += std::stod(x);
+        return s;
+    });
+    measure("day11::parse   ", floats.size(), [&]{
+        double s = 0;
+        for (auto &x : floats) s += day11::parse_as<double>(x).value_or(0);
+        return s;
+    });
+
+    std::cout << "\n== 错误处理 ==\n";
+    for (std::string_view in : {"8080", "65536", "-1", "80a", "", "+443"}) {
+        std::uint16_t port = 0;
+        auto ec = day11::parse(in, port);
+        std::cout << "  \"" << in << "\" -> "
+                  << (ec == std::errc{} ? std::to_string(port)
+                      : ec == std::errc::result_out_of_range ? "out of range" : "invalid") << "\n";
+    }
+    for (std::string_view in : {"TRUE", "off", "Yes", "t"}) {
+        auto b = day11::parse_bool(in);
+        std::cout << "  \"" << in << "\" -> " << (b ? (*b ? "true" : "false") : "nullopt") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "${BASH_SOURCE[0]%/*}" && pwd)"
+BUILD_DIR="${SCRIPT_DIR}/../build/day11"
+SRC_DIR="${SCRIPT_DIR}"
+
+usage() {
+  cat <<'EOF'
+用法: ./run.sh [simd|split|join|parse|all]
+  simd  编译运行向量化 trim/starts_with/count_words 基准（标量 / SSE4.2 / AVX2，GB/s）
+  split 编译运行零分配 split 示例（对比 vector<string>，统计堆分配次数）
+  join  编译运行 join / StringBuilder 示例（对比 += 拼接，统计堆分配次数）
+  parse 编译运行数值/bool 解析示例（对比 stoll / istringstream / from_chars）
+  all   编译运行全部示例（默认）
+EOF
+}
+
+build() {
+  mkdir -p "${BUILD_DIR}"
+  local target="$1" src="$2"; shift 2
+  echo "[BUILD] ${src} -> ${target}"
+  g++ -std=c++17 -O0 -g -Wall -Wextra -pedantic "$@" \
+      "${SRC_DIR}/${src}" -o "${BUILD_DIR}/${target}"
+}
+
+run_simd() {
+  build "simd_bench" "simd_bench.cpp" -O2
+  echo "[RUN ] simd_bench" && "${BUILD_DIR}/simd_bench"
+}
+
+run_split() {
+  build "split" "split_demo.cpp" -O2
+  echo "[RUN ] split" && "${BUILD_DIR}/split"
+}
+
+run_join() {
+  build "join" "join_demo.cpp" -O2
+  echo "[RUN ] join" && "${BUILD_DIR}/join"
+}
+
+run_parse() {
+  build "parse" "parse_demo.cpp" -O2
+  echo "[RUN ] parse" && "${BUILD_DIR}/parse"
+}
+
+choice=${1:-all}
+case "${choice}" in
+  simd) run_simd ;;
+  split) run_split ;;
+  join) run_join ;;
+  parse) run_parse ;;
+  all)  run_simd; run_split; run_join; run_parse ;;
+  -h|--help) usage ;;
+  *) usage; exit 1 ;;
+esac
@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "simd_string.hpp"
+
+// 在 16 MiB 的“日志”缓冲区上跑各级内核：先与标量版对拍，再报告 GB/s
+using Clock = std::chrono::steady_clock;
+
+static std::string make_buffer(std::size_t bytes) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> word_len(1, 12), gap(1, 3), ch('a', 'z');
+    std::string s(bytes / 8, ' ');   // 前导空格：给 trim 一段长的要扫
+    while (s.size() < bytes - bytes / 8) {
+        for (int i = word_len(rng); i > 0; --i) s.push_back(static_cast<char>(ch(rng)));
+        if (rng() % 16 == 0) s.push_back('\n');
+        s.append(static_cast<std::size_t>(gap(rng)), ' ');
+    }
+    s.append(bytes - s.size(), ' ');  // 尾随空格
+    return s;
+}
+
+template <class F>
+static double gbps(std::size_t bytes, int reps, F f) {
+    auto t0 = Clock::now();
+    for (int r = 0; r < reps; ++r) f();
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    return static_cast<double>(bytes) * reps / secs / 1e9;
+}
+
+int main() {
+    const std::size_t bytes = 16u << 20;
+    const int reps = 20;
+    std::string buf = make_buffer(bytes);
+    std::string copy = buf;
+    std::string_view sv(buf);
+
+    const auto &ref = day11::kernels_for(day11::SimdLevel::kScalar);
+    auto words = ref.count_words(sv.data(), sv.size());
+    auto lines = ref.count_byte(sv.data(), sv.size(), '\n');
+    auto lead = ref.skip_spaces(sv.data(), sv.size());
+    auto trail = ref.rskip_spaces(sv.data(), sv.size());
+    std::cout << "buffer " << (bytes >> 20) << " MiB: " << words << " words, " << lines
+              << " lines, active=" << day11::to_string(day11::active_simd_level()) << "\n";
+
+    volatile std::size_t sink = 0;
+    for (auto level : {day11::SimdLevel::kScalar, day11::SimdLevel::kSSE42, day11::SimdLevel::kAVX2}) {
+        const auto &k = day11::kernels_for(level);
+        bool ok = k.count_words(sv.data(), sv.size()) == words &&
+                  k.count_byte(sv.data(), sv.size(), '\n') == lines &&
+                  k.skip_spaces(sv.data(), sv.size()) == lead &&
+                  k.rskip_spaces(sv.data(), sv.size()) == trail &&
+                  k.equal(sv.data(), copy.data(), sv.size());
+        // trim 只扫首尾两段空格，按实际扫过的字节数计速
+        double trim_gbps = gbps(lead + trail, reps * 10, [&]{
+            sink = sink + k.skip_spaces(sv.data(), sv.size()) + k.rskip_spaces(sv.data(), sv.size());
+        });
+        double eq = gbps(bytes, reps, [&]{ sink = sink + k.equal(sv.data(), copy.data(), sv.size()); });
+        double cw = gbps(bytes, reps, [&]{ sink = sink + k.count_words(sv.data(), sv.size()); });
+        double cb = gbps(bytes, reps, [&]{ sink = sink + k.count_byte(sv.data(), sv.size(), '\n'); });
+        std::cout << day11::to_string(level) << (ok ? "" : " MISMATCH") << ": trim " << trim_gbps
+                  << " GB/s, starts_with " << eq << " GB/s, count_words " << cw
+                  << " GB/s, count_byte " << cb << " GB/s\n";
+    }
+
+    std::cout << "\n== 公共接口 ==\n";
+    std::cout << "[" << day11::trim("   hello world  ") << "] "
+              << day11::starts_with("GET /index.html", "GET ") << " "
+              << day11::count_words("  the quick   brown fox ") << "\n";
+    return 0;
+}
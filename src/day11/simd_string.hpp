@@ -0,0 +1,394 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DAY11_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define DAY11_X86_SIMD 0
+#endif
+
+// 向量化的字符串小工具：trim / starts_with / count_words / count_byte / find_byte / find_any
+// 典型用法：
+//   auto body  = day11::trim(line);                  // 去掉首尾空格（只认 ' '，与 test1 相同）
+//   bool hit   = day11::starts_with(line, "GET ");
+//   auto words = day11::count_words(buf);            // 以一个或多个连续空格分隔
+//   auto lines = day11::count_byte(buf, '\n');
+//
+// 设计要点：
+// - 签名、语义与 training/test1.cpp 的 trim / starts_with / count_words 保持一致，只换实现
+// - 三套内核：标量（任何平台）、SSE4.2（16 字节一块）、AVX2（32 字节一块）；
+//   x86-64 上用 __attribute__((target)) 单独编译 SIMD 版本，不需要整个程序加 -mavx2，
+//   第一次调用时按 CPU 能力选定一套（__builtin_cpu_supports），之后只是一次间接调用
+// - count_words 的向量版：非空格掩码 m，词首 = m & ~(m << 1 | 上一块最高位)，popcount 计数
+// - 不足一块的尾部交给标量版处理
+
+namespace day11 {
+
+enum class SimdLevel { kScalar, kSSE42, kAVX2 };
+
+inline const char *to_string(SimdLevel l) noexcept {
+    switch (l) {
+    case SimdLevel::kAVX2:  return "avx2";
+    case SimdLevel::kSSE42: return "sse4.2";
+    default:                return "scalar";
+    }
+}
+
+// 一套内核的函数表
+struct StringKernels {
+    std::size_t (*skip_spaces)(const char *p, std::size_t n);    // 前导空格个数
+    std::size_t (*rskip_spaces)(const char *p, std::size_t n);   // 尾随空格个数
+    bool (*equal)(const char *a, const char *b, std::size_t n);
+    std::size_t (*count_words)(const char *p, std::size_t n);
+    std::size_t (*count_byte)(const char *p, std::size_t n, char c);
+    std::size_t (*find_byte)(const char *p, std::size_t n, char c);          // 找不到返回 n
+    std::size_t (*find_any)(const char *p, std::size_t n,
+                            const char *set, std::size_t set_n);             // 同上
+};
+
+namespace scalar {
+
+inline std::size_t skip_spaces(const char *p, std::size_t n) {
+    std::size_t i = 0;
+    while (i < n && p[i] == ' ') ++i;
+    return i;
+}
+
+inline std::size_t rskip_spaces(const char *p, std::size_t n) {
+    std::size_t i = 0;
+    while (i < n && p[n - 1 - i] == ' ') ++i;
+    return i;
+}
+
+inline bool equal(const char *a, const char *b, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// prev_space：p[-1] 是否为空格（或 p 是开头）
+inline std::size_t count_words_from(const char *p, std::size_t n, bool prev_space) {
+    std::size_t words = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        bool space = p[i] == ' ';
+        if (!space && prev_space) ++words;
+        prev_space = space;
+    }
+    return words;
+}
+
+inline std::size_t count_words(const char *p, std::size_t n) { return count_words_from(p, n, true); }
+
+inline std::size_t count_byte(const char *p, std::size_t n, char c) {
+    std::size_t cnt = 0;
+    for (std::size_t i = 0; i < n; ++i) cnt += p[i] == c;
+    return cnt;
+}
+
+inline std::size_t find_byte(const char *p, std::size_t n, char c) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (p[i] == c) return i;
+    }
+    return n;
+}
+
+inline std::size_t find_any(const char *p, std::size_t n, const char *set, std::size_t set_n) {
+    bool table[256] = {};
+    for (std::size_t i = 0; i < set_n; ++i) table[static_cast<unsigned char>(set[i])] = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (table[static_cast<unsigned char>(p[i])]) return i;
+    }
+    return n;
+}
+
+inline constexpr StringKernels kKernels{skip_spaces, rskip_spaces, equal, count_words, count_byte,
+                                        find_byte, find_any};
+
+} // namespace scalar
+
+#if DAY11_X86_SIMD
+
+// 16 字节一块；pcmpeqb + pmovmskb 得到每字节一位的掩码
+namespace sse42 {
+
+#define DAY11_SSE42 __attribute__((target("sse4.2,popcnt")))
+
+DAY11_SSE42 inline std::uint32_t space_mask(const char *p) {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(' '))));
+}
+
+DAY11_SSE42 inline std::size_t skip_spaces(const char *p, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        std::uint32_t other = ~space_mask(p + i) & 0xFFFFu;
+        if (other) return i + static_cast<std::size_t>(__builtin_ctz(other));
+    }
+    return i + scalar::skip_spaces(p + i, n - i);
+}
+
+DAY11_SSE42 inline std::size_t rskip_spaces(const char *p, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        std::uint32_t other = ~space_mask(p + n - i - 16) & 0xFFFFu;
+        if (other) return i + static_cast<std::size_t>(__builtin_clz(other) - 16);
+    }
+    return i + scalar::rskip_spaces(p, n - i);
+}
+
+DAY11_SSE42 inline bool equal(const char *a, const char *b, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        auto va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        auto vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xFFFF) return false;
+    }
+    return scalar::equal(a + i, b + i, n - i);
+}
+
+DAY11_SSE42 inline std::size_t count_words(const char *p, std::size_t n) {
+    std::size_t words = 0;
+    std::uint32_t carry = 1; // 开头之前视为空格
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        std::uint32_t word = ~space_mask(p + i) & 0xFFFFu;
+        std::uint32_t starts = word & ~((word << 1) | (carry ^ 1u));
+        words += static_cast<std::size_t>(__builtin_popcount(starts));
+        carry = (word >> 15) ^ 1u; // 本块最后一个字节是空格则为 1
+    }
+    return words + scalar::count_words_from(p + i, n - i, carry != 0);
+}
+
+DAY11_SSE42 inline std::size_t count_byte(const char *p, std::size_t n, char c) {
+    auto needle = _mm_set1_epi8(c);
+    std::size_t cnt = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        cnt += static_cast<std::size_t>(__builtin_popcount(
+            static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)))));
+    }
+    return cnt + scalar::count_byte(p + i, n - i, c);
+}
+
+DAY11_SSE42 inline std::size_t find_byte(const char *p, std::size_t n, char c) {
+    auto needle = _mm_set1_epi8(c);
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        auto m = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+        if (m) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return i + scalar::find_byte(p + i, n - i, c);
+}
+
+// 分隔符集合不超过 16 个字节时用 pcmpistri（“任一字符相等”模式），否则退回查表
+DAY11_SSE42 inline std::size_t find_any(const char *p, std::size_t n,
+                                        const char *set, std::size_t set_n) {
+    if (set_n == 0 || set_n > 16) return scalar::find_any(p, n, set, set_n);
+    alignas(16) char buf[16] = {};
+    std::memcpy(buf, set, set_n);
+    auto needles = _mm_load_si128(reinterpret_cast<const __m128i *>(buf));
+    const int ln = static_cast<int>(set_n);
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        int idx = _mm_cmpestri(needles, ln, v, 16,
+                               _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+        if (idx < 16) return i + static_cast<std::size_t>(idx);
+    }
+    return i + scalar::find_any(p + i, n - i, set, set_n);
+}
+
+#undef DAY11_SSE42
+
+inline constexpr StringKernels kKernels{skip_spaces, rskip_spaces, equal, count_words, count_byte,
+                                        find_byte, find_any};
+
+} // namespace sse42
+
+// 32 字节一块
+namespace avx2 {
+
+#define DAY11_AVX2 __attribute__((target("avx2,popcnt")))
+
+DAY11_AVX2 inline std::uint32_t space_mask(const char *p) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    return static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '))));
+}
+
+DAY11_AVX2 inline std::size_t skip_spaces(const char *p, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        std::uint32_t other = ~space_mask(p + i);
+        if (other) return i + static_cast<std::size_t>(__builtin_ctz(other));
+    }
+    return i + scalar::skip_spaces(p + i, n - i);
+}
+
+DAY11_AVX2 inline std::size_t rskip_spaces(const char *p, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        std::uint32_t other = ~space_mask(p + n - i - 32);
+        if (other) return i + static_cast<std::size_t>(__builtin_clz(other));
+    }
+    return i + scalar::rskip_spaces(p, n - i);
+}
+
+DAY11_AVX2 inline bool equal(const char *a, const char *b, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        auto va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        auto vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        if (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb))) != 0xFFFFFFFFu) {
+            return false;
+        }
+    }
+    return scalar::equal(a + i, b + i, n - i);
+}
+
+DAY11_AVX2 inline std::size_t count_words(const char *p, std::size_t n) {
+    std::size_t words = 0;
+    std::uint64_t carry = 1;
+    std::size_t i = 0;
+    // 两块拼成 64 位掩码，一次移位 + popcount 处理 64 字节
+    for (; i + 64 <= n; i += 64) {
+        std::uint64_t spaces = space_mask(p + i) |
+                               (static_cast<std::uint64_t>(space_mask(p + i + 32)) << 32);
+        std::uint64_t word = ~spaces;
+        std::uint64_t starts = word & ~((word << 1) | (carry ^ 1u));
+        words += static_cast<std::size_t>(__builtin_popcountll(starts));
+        carry = spaces >> 63;
+    }
+    return words + scalar::count_words_from(p + i, n - i, carry != 0);
+}
+
+DAY11_AVX2 inline std::size_t count_byte(const char *p, std::size_t n, char c) {
+    auto needle = _mm256_set1_epi8(c);
+    std::size_t cnt = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        cnt += static_cast<std::size_t>(__builtin_popcount(
+            static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)))));
+    }
+    return cnt + scalar::count_byte(p + i, n - i, c);
+}
+
+DAY11_AVX2 inline std::size_t find_byte(const char *p, std::size_t n, char c) {
+    auto needle = _mm256_set1_epi8(c);
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        auto m = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+        if (m) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return i + scalar::find_byte(p + i, n - i, c);
+}
+
+// 分隔符不多（常见的 " ,;\t\r\n" 之类）时每个字符一次 cmpeq 再 OR 起来；多了交给 SSE4.2 版
+DAY11_AVX2 inline std::size_t find_any(const char *p, std::size_t n,
+                                       const char *set, std::size_t set_n) {
+    constexpr std::size_t kMaxSet = 8;
+    if (set_n == 0 || set_n > kMaxSet) return sse42::find_any(p, n, set, set_n);
+    __m256i needles[kMaxSet];
+    for (std::size_t k = 0; k < set_n; ++k) needles[k] = _mm256_set1_epi8(set[k]);
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        auto hit = _mm256_cmpeq_epi8(v, needles[0]);
+        for (std::size_t k = 1; k < set_n; ++k) hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, needles[k]));
+        auto m = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+        if (m) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return i + scalar::find_any(p + i, n - i, set, set_n);
+}
+
+#undef DAY11_AVX2
+
+inline constexpr StringKernels kKernels{skip_spaces, rskip_spaces, equal, count_words, count_byte,
+                                        find_byte, find_any};
+
+} // namespace avx2
+
+#endif // DAY11_X86_SIMD
+
+// 当前 CPU 支持的最高一级
+inline SimdLevel detect_simd_level() noexcept {
+#if DAY11_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::kAVX2;
+    if (__builtin_cpu_supports("sse4.2")) return SimdLevel::kSSE42;
+#endif
+    return SimdLevel::kScalar;
+}
+
+// 指定一级的内核（基准测试 / 对拍用）；CPU 不支持时退回标量
+inline const StringKernels &kernels_for(SimdLevel level) noexcept {
+#if DAY11_X86_SIMD
+    auto best = detect_simd_level();
+    if (level == SimdLevel::kAVX2 && best == SimdLevel::kAVX2) return avx2::kKernels;
+    if (level != SimdLevel::kScalar && best != SimdLevel::kScalar) return sse42::kKernels;
+#else
+    (void)level;
+#endif
+    return scalar::kKernels;
+}
+
+// 运行时选定的内核，只检测一次
+inline const StringKernels &kernels() noexcept {
+    static const StringKernels &k = kernels_for(detect_simd_level());
+    return k;
+}
+
+inline SimdLevel active_simd_level() noexcept {
+    static const SimdLevel level = detect_simd_level();
+    return level;
+}
+
+// ---- 对外接口：与 training/test1.cpp 相同的签名 ----
+
+// 去掉前后空格（只考虑 ' '），返回的是 s 的子视图
+inline std::string_view trim(std::string_view s) {
+    const auto &k = kernels();
+    auto l = k.skip_spaces(s.data(), s.size());
+    if (l == s.size()) return s.substr(s.size());
+    auto r = k.rskip_spaces(s.data() + l, s.size() - l);
+    return s.substr(l, s.size() - l - r);
+}
+
+inline bool starts_with(std::string_view s, std::string_view prefix) {
+    if (prefix.size() > s.size()) return false;
+    return kernels().equal(s.data(), prefix.data(), prefix.size());
+}
+
+// 按空格分隔的单词个数（一个或多个连续空格都算一个分隔）
+inline std::size_t count_words(std::string_view s) {
+    return kernels().count_words(s.data(), s.size());
+}
+
+// 某个字节出现的次数（行数、分隔符个数等）
+inline std::size_t count_byte(std::string_view s, char c) {
+    return kernels().count_byte(s.data(), s.size(), c);
+}
+
+// 第一个等于 c 的位置，找不到返回 npos
+inline std::size_t find_byte(std::string_view s, char c) {
+    auto i = kernels().find_byte(s.data(), s.size(), c);
+    return i == s.size() ? std::string_view::npos : i;
+}
+
+// 第一个属于 set 的字节的位置，找不到返回 npos（等价于 find_first_of）
+inline std::size_t find_any(std::string_view s, std::string_view set) {
+    auto i = kernels().find_any(s.data(), s.size(), set.data(), set.size());
+    return i == s.size() ? std::string_view::npos : i;
+}
+
+} // namespace day11
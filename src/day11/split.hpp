@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include "simd_string.hpp"
+
+// split：惰性切分 string_view，逐个产出 string_view 片段，全程不分配内存
+// 典型用法：
+//   for (auto tok : day11::split(line, ' ', day11::SplitMode::kSkipEmpty)) { ... }  // 单字符
+//   for (auto field : day11::split(record, "||")) { ... }                            // 多字符分隔符整体匹配
+//   for (auto tok : day11::split_any(text, " \t\r\n", day11::SplitMode::kSkipEmpty)) { ... } // 任一字符
+//
+// 设计要点：
+// - 片段都是原字符串的子视图：调用方必须保证原字符串比这些片段活得久
+// - 查找分隔符走 simd_string.hpp 的 find_byte / find_any（AVX2/SSE4.2 运行时分派）；
+//   多字符分隔符先向量化找首字节，再比较剩余部分
+// - kKeepEmpty（默认）：与常见 split 语义一致，"a,,b" -> "a" "" "b"，"" -> 一个空片段；
+//   kSkipEmpty：丢掉所有空片段，连续分隔符视为一个，"" -> 没有片段；
+//   空的多字符分隔符不切分，整个输入作为一个片段
+// - 迭代器是前向迭代器，可以直接用在 range-for 和 <algorithm> 里
+
+namespace day11 {
+
+enum class SplitMode { kKeepEmpty, kSkipEmpty };
+
+namespace detail {
+
+// 三种分隔符查找策略：find(s, from) 返回 {分隔符位置, 分隔符长度}，找不到位置为 npos
+struct CharDelim {
+    char c;
+    std::size_t find(std::string_view s, std::size_t from) const noexcept {
+        auto i = find_byte(s.substr(from), c);
+        return i == std::string_view::npos ? i : from + i;
+    }
+    std::size_t length() const noexcept { return 1; }
+};
+
+struct AnyOfDelim {
+    std::string_view set;
+    std::size_t find(std::string_view s, std::size_t from) const noexcept {
+        auto i = find_any(s.substr(from), set);
+        return i == std::string_view::npos ? i : from + i;
+    }
+    std::size_t length() const noexcept { return 1; }
+};
+
+struct SeqDelim {
+    std::string_view seq;
+    std::size_t find(std::string_view s, std::size_t from) const noexcept {
+        if (seq.empty()) return std::string_view::npos; // 空分隔符不切分：整段作为一个片段
+        while (from + seq.size() <= s.size()) {
+            auto i = find_byte(s.substr(from, s.size() - from - seq.size() + 1), seq[0]);
+            if (i == std::string_view::npos) return i;
+            from += i;
+            if (s.compare(from + 1, seq.size() - 1, seq.substr(1)) == 0) return from;
+            ++from;
+        }
+        return std::string_view::npos;
+    }
+    std::size_t length() const noexcept { return seq.size(); }
+};
+
+} // namespace detail
+
+template <class Delim>
+class SplitRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const std::string_view *;
+        using reference         = const std::string_view &;
+
+        iterator() = default;
+
+        reference operator*() const noexcept { return tok_; }
+        pointer operator->() const noexcept { return &tok_; }
+
+        iterator &operator++() noexcept {
+            advance();
+            return *this;
+        }
+        iterator operator++(int) noexcept {
+            auto old = *this;
+            advance();
+            return old;
+        }
+
+        friend bool operator==(const iterator &a, const iterator &b) noexcept {
+            return a.done_ == b.done_ && (a.done_ || a.next_ == b.next_);
+        }
+        friend bool operator!=(const iterator &a, const iterator &b) noexcept { return !(a == b); }
+
+    private:
+        friend class SplitRange;
+
+        explicit iterator(const SplitRange *r) noexcept : r_(r), next_(0), done_(false) {
+            advance();
+        }
+
+        // next_ 指向下一个片段的起点；超过末尾（size + 1）表示最后一个片段已经产出
+        void advance() noexcept {
+            const auto s = r_->s_;
+            while (next_ <= s.size()) {
+                auto pos = r_->delim_.find(s, next_);
+                auto end = pos == std::string_view::npos ? s.size() : pos;
+                tok_ = s.substr(next_, end - next_);
+                next_ = pos == std::string_view::npos ? s.size() + 1 : pos + r_->delim_.length();
+                if (!tok_.empty() || r_->mode_ == SplitMode::kKeepEmpty) return;
+            }
+            done_ = true;
+        }
+
+        const SplitRange *r_ = nullptr;
+        std::string_view tok_;
+        std::size_t next_ = 0;
+        bool done_ = true;
+    };
+
+    SplitRange(std::string_view s, Delim d, SplitMode mode) noexcept
+        : s_(s), delim_(d), mode_(mode) {}
+
+    iterator begin() const noexcept { return iterator(this); }
+    iterator end() const noexcept { return iterator(); }
+
+private:
+    std::string_view s_;
+    Delim delim_;
+    SplitMode mode_;
+};
+
+inline SplitRange<detail::CharDelim> split(std::string_view s, char delim,
+                                           SplitMode mode = SplitMode::kKeepEmpty) noexcept {
+    return {s, detail::CharDelim{delim}, mode};
+}
+
+// 整个 delim 作为一个分隔符；delim 为单字符时等同于上面的版本。
+// delim 为空时不切分，整个 s 是唯一的片段（kSkipEmpty 下 s 为空则没有片段）
+inline SplitRange<detail::SeqDelim> split(std::string_view s, std::string_view delim,
+                                          SplitMode mode = SplitMode::kKeepEmpty) noexcept {
+    return {s, detail::SeqDelim{delim}, mode};
+}
+
+// delims 里任意一个字符都是分隔符
+inline SplitRange<detail::AnyOfDelim> split_any(std::string_view s, std::string_view delims,
+                                                SplitMode mode = SplitMode::kKeepEmpty) noexcept {
+    return {s, detail::AnyOfDelim{delims}, mode};
+}
+
+} // namespace day11
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "split.hpp"
+
+// 统计全局堆分配次数：替换全局 operator new/delete（仅本示例）
+static std::atomic<long> g_allocs{0};
+
+void *operator new(std::size_t n) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+using Clock = std::chrono::steady_clock;
+
+// 原来的写法：为了拿到每个词，先切成 vector<string>
+static std::vector<std::string> split_copy(const std::string &s, char delim) {
+    std::vector<std::string> out;
+    std::string cur;
+    for (char c : s) {
+        if (c == delim) {
+            if (!cur.empty()) out.push_back(cur);
+            cur.clear();
+        } else {
+            cur += c;
+        }
+    }
+    if (!cur.empty()) out.push_back(cur);
+    return out;
+}
+
+template <class F>
+static void measure(const char *name, std::size_t bytes, F f) {
+    long allocs = g_allocs.load();
+    auto t0 = Clock::now();
+    std::size_t tokens = f();
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    std::cout << "  " << name << ": " << tokens << " tokens, "
+              << static_cast<double>(bytes) / secs / 1e9 << " GB/s, "
+              << g_allocs.load() - allocs << " allocs\n";
+}
+
+int main() {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> len(1, 20), gap(1, 2), ch('a', 'z');
+    std::string buf;
+    while (buf.size() < (8u << 20)) {
+        for (int i = len(rng); i > 0; --i) buf.push_back(static_cast<char>(ch(rng)));
+        buf.append(static_cast<std::size_t>(gap(rng)), ' ');
+    }
+
+    std::cout << "== 8 MiB 文本按空格切词 ==\n";
+    measure("vector<string>   ", buf.size(), [&]{ return split_copy(buf, ' ').size(); });
+    measure("split (skip empty)", buf.size(), [&]{
+        std::size_t n = 0, chars = 0;
+        for (auto tok : day11::split(buf, ' ', day11::SplitMode::kSkipEmpty)) {
+            ++n;
+            chars += tok.size();
+        }
+        return chars ? n : 0;
+    });
+
+    std::cout << "\n== 多字符分隔符 / 任一字符 ==\n";
+    std::string_view record = "id=42||name=widget||tags=a,b;c||";
+    for (auto field : day11::split(record, "||")) std::cout << "[" << field << "] ";
+    std::cout << "\n";
+    for (auto tok : day11::split_any("a, b;;c ,d", " ,;", day11::SplitMode::kSkipEmpty)) {
+        std::cout << "[" << tok << "] ";
+    }
+    std::cout << "\n";
+    // 空分隔符：不切分，整行是一个片段（不会读越界，也不会原地打转）
+    for (auto tok : day11::split("no delimiter", "")) std::cout << "[" << tok << "] ";
+    std::cout << "\n";
+    return 0;
+}
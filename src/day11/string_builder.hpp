@@ -0,0 +1,160 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// join / StringBuilder：一次算好长度再拷贝的拼接，以及带栈上内联缓冲区的拼接器
+// 典型用法：
+//   auto line = day11::join(parts, ", ");                // 先求总长，分配一次，逐段 memcpy
+//   day11::StringBuilder<> sb;                           // 默认 256 字节内联缓冲区，放得下就不碰堆
+//   sb << "HTTP/1.1 " << 200 << " OK\r\nContent-Length: " << body.size() << "\r\n\r\n";
+//   write(fd, sb.data(), sb.size());                     // 或 sb.view() / sb.str()
+//
+// 设计要点：
+// - join 接受任意元素可转成 string_view 的区间（vector<string>、vector<string_view>、数组……），
+//   两遍扫描：第一遍求总长，第二遍直接往结果里 memcpy，没有 += 的反复扩容
+// - StringBuilder 内联缓冲区用完才溢出到堆，之后按 2 倍扩容；clear() 保留容量，循环里可反复使用
+// - 整数/浮点数用 std::to_chars 直接写进缓冲区，不经过 iostream，也不受 locale 影响
+
+namespace day11 {
+
+// 元素能转成 string_view 的任意区间
+template <class Range>
+std::string join(const Range &parts, std::string_view sep) {
+    std::size_t total = 0;
+    std::size_t count = 0;
+    for (const auto &p : parts) {
+        total += std::string_view(p).size();
+        ++count;
+    }
+    if (count == 0) return {};
+    total += sep.size() * (count - 1);
+
+    std::string out(total, '\0');
+    char *dst = out.data();
+    bool first = true;
+    for (const auto &p : parts) {
+        std::string_view v(p);
+        if (!first && !sep.empty()) {
+            std::memcpy(dst, sep.data(), sep.size());
+            dst += sep.size();
+        }
+        first = false;
+        if (!v.empty()) std::memcpy(dst, v.data(), v.size());
+        dst += v.size();
+    }
+    return out;
+}
+
+// training/test1.cpp 的签名
+inline std::string join_strings(const std::vector<std::string> &v, const std::string &sep) {
+    return join(v, sep);
+}
+
+template <std::size_t N = 256>
+class StringBuilder {
+    static_assert(N > 0, "StringBuilder 的内联缓冲区至少 1 字节");
+
+public:
+    StringBuilder() noexcept = default;
+
+    StringBuilder(const StringBuilder&) = delete;
+    StringBuilder& operator=(const StringBuilder&) = delete;
+
+    const char *data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return cap_; }
+    bool empty() const noexcept { return size_ == 0; }
+    bool on_heap() const noexcept { return heap_ != nullptr; }
+
+    std::string_view view() const noexcept { return {data_, size_}; }
+    std::string str() const { return std::string(data_, size_); }
+
+    // 清空内容，保留容量
+    void clear() noexcept { size_ = 0; }
+
+    void reserve(std::size_t n) {
+        if (n > cap_) grow(n);
+    }
+
+    StringBuilder &append(std::string_view s) {
+        if (s.empty()) return *this;
+        reserve(size_ + s.size());
+        std::memcpy(data_ + size_, s.data(), s.size());
+        size_ += s.size();
+        return *this;
+    }
+
+    StringBuilder &append(char c) {
+        reserve(size_ + 1);
+        data_[size_++] = c;
+        return *this;
+    }
+
+    StringBuilder &append(std::size_t count, char c) {
+        reserve(size_ + count);
+        std::memset(data_ + size_, c, count);
+        size_ += count;
+        return *this;
+    }
+
+    // 整数与浮点数（浮点按最短可还原表示）
+    template <class T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                                        !std::is_same_v<T, char>, int> = 0>
+    StringBuilder &append(T v) {
+        constexpr std::size_t kMaxChars = std::is_integral_v<T> ? 24 : 32;
+        reserve(size_ + kMaxChars);
+        auto r = std::to_chars(data_ + size_, data_ + cap_, v);
+        size_ = static_cast<std::size_t>(r.ptr - data_);
+        return *this;
+    }
+
+    StringBuilder &append(bool b) { return append(b ? std::string_view("true") : std::string_view("false")); }
+
+    // 分隔拼接：与 join 相同，只是追加到本缓冲区
+    template <class Range>
+    StringBuilder &append_joined(const Range &parts, std::string_view sep) {
+        bool first = true;
+        for (const auto &p : parts) {
+            if (!first) append(sep);
+            first = false;
+            append(std::string_view(p));
+        }
+        return *this;
+    }
+
+    template <class T>
+    StringBuilder &operator<<(const T &v) {
+        if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+            return append(std::string_view(v));
+        } else {
+            return append(v);
+        }
+    }
+
+private:
+    void grow(std::size_t need) {
+        std::size_t cap = cap_ * 2;
+        if (cap < need) cap = need;
+        auto mem = std::make_unique<char[]>(cap);
+        std::memcpy(mem.get(), data_, size_);
+        heap_ = std::move(mem);
+        data_ = heap_.get();
+        cap_ = cap;
+    }
+
+    char inline_[N];
+    std::unique_ptr<char[]> heap_;
+    char *data_ = inline_;
+    std::size_t size_ = 0;
+    std::size_t cap_ = N;
+};
+
+} // namespace day11
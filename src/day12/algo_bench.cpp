@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "algorithms.hpp"
+
+// 10M 个 int：std:: 串行版本 vs 各级 SIMD 内核 vs 线程池分块并行
+using Clock = std::chrono::steady_clock;
+
+template <class F>
+static double ms(F f) {
+    auto t0 = Clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+int main() {
+    const std::size_t n = 10000000;
+    std::mt19937 rng(1);
+    std::vector<int> data(n);
+    for (auto &x : data) x = static_cast<int>(rng() % 1000000);
+    data[n - 3] = -1;   // find_if 的目标放在末尾附近，逼它扫完几乎整个数组
+
+    unsigned hw = std::max(2u, std::thread::hardware_concurrency());
+    day14::ThreadPool pool(hw, 1024);
+    day12::Exec par{&pool};
+    std::cout << n << " ints, simd=" << day12::to_string(day12::active_simd_level())
+              << ", pool threads=" << hw << "\n";
+
+    auto report = [](const std::string &name, double t, bool ok) {
+        std::cout << "  " << name << ": " << t << " ms" << (ok ? "" : "  MISMATCH") << "\n";
+    };
+
+    std::cout << "remove_odd:\n";
+    std::vector<int> expect = data;
+    double t = ms([&]{ expect.erase(std::remove_if(expect.begin(), expect.end(), [](int x){ return x & 1; }),
+                                    expect.end()); });
+    report("std::remove_if", t, true);
+    for (auto lv : {day12::SimdLevel::kScalar, day12::SimdLevel::kAVX2, day12::SimdLevel::kAVX512}) {
+        auto v = data;
+        t = ms([&]{ v.resize(day12::remove_if_n(v.data(), v.size(), day12::IsOdd{}, lv)); });
+        report(std::string("kernel ") + day12::to_string(lv), t, v == expect);
+    }
+    {
+        auto v = data;
+        t = ms([&]{ day12::remove_odd(v, par); });
+        report("parallel", t, v == expect);
+    }
+
+    std::cout << "find_if(x < 0):\n";
+    auto pos = static_cast<std::size_t>(std::find_if(data.begin(), data.end(), [](int x){ return x < 0; }) - data.begin());
+    t = ms([&]{ pos = static_cast<std::size_t>(std::find_if(data.begin(), data.end(), [](int x){ return x < 0; }) - data.begin()); });
+    report("std::find_if", t, true);
+    for (auto lv : {day12::SimdLevel::kScalar, day12::SimdLevel::kAVX2, day12::SimdLevel::kAVX512}) {
+        std::size_t got = 0;
+        t = ms([&]{ got = day12::find_if_n(data.data(), n, day12::LessThan{0}, lv); });
+        report(std::string("kernel ") + day12::to_string(lv), t, got == pos);
+    }
+    std::size_t got = 0;
+    t = ms([&]{ got = day12::find_if(data, day12::LessThan{0}, par); });
+    report("parallel", t, got == pos);
+    // 命中在第一块的前部：其余块看到 best 后在第一段就停下，不再各自扫完整块
+    data[1000] = -2;
+    t = ms([&]{ got = day12::find_if(data, day12::LessThan{0}, par); });
+    report("parallel, hit at 1000", t, got == 1000);
+    data[1000] = 0;
+
+    std::cout << "count_greater_than(500000):\n";
+    std::size_t cnt = 0;
+    t = ms([&]{ cnt = static_cast<std::size_t>(std::count_if(data.begin(), data.end(), [](int x){ return x > 500000; })); });
+    report("std::count_if", t, true);
+    for (auto lv : {day12::SimdLevel::kScalar, day12::SimdLevel::kAVX2, day12::SimdLevel::kAVX512}) {
+        std::size_t c = 0;
+        t = ms([&]{ c = day12::count_if_n(data.data(), n, day12::GreaterThan{500000}, lv); });
+        report(std::string("kernel ") + day12::to_string(lv), t, c == cnt);
+    }
+    std::size_t c = 0;
+    t = ms([&]{ c = day12::count_greater_than(data, 500000, par); });
+    report("parallel", t, c == cnt);
+
+    std::cout << "sort:\n";
+    auto sorted = data;
+    t = ms([&]{ std::sort(sorted.begin(), sorted.end()); });
+    report("std::sort", t, true);
+    auto v = data;
+    t = ms([&]{ day12::sort(v, par); });
+    report("parallel", t, v == sorted);
+    return 0;
+}
@@ -0,0 +1,441 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DAY12_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define DAY12_X86_SIMD 0
+#endif
+
+#include "../day14/thread_pool.hpp"
+
+// int 向量上的 remove_if / find_if / count_if / sort：SIMD 内核 + 超过阈值时在 day14::ThreadPool 上分块并行
+// 典型用法：
+//   day12::remove_odd(v);                                   // 与 test1 同名同语义，内部走 SIMD 压缩
+//   day14::ThreadPool pool(8, 1024);
+//   day12::Exec par{&pool};                                 // 元素数 >= par.threshold 时并行
+//   auto i = day12::find_if(v, day12::GreaterThan{100}, par);
+//   day12::sort(v, par);
+//
+// 设计要点：
+// - 谓词是少数几个“可向量化”的比较（IsOdd / IsEven / GreaterThan / LessThan / EqualTo），
+//   每个谓词同时提供标量、AVX2、AVX-512 三种写法，算法模板按运行时检测到的 CPU 能力选一种
+// - remove_if 的 SIMD 压缩：AVX-512 直接用 vpcompressd（masked compress store）；
+//   AVX2 用“保留掩码 -> 查表得到排列 -> vpermd -> 整块写出、按 popcount 前进”。
+//   原地压缩是安全的：写指针永远不超过读指针，整块写出覆盖的只有已经读进寄存器的元素
+// - 并行路径：切成 (线程数 * 4) 块交给线程池，各块独立计算后再串行合并
+//   （remove_if 把各块结果依次挪到前面；find_if 取最小下标；sort 先块内排序再两两归并）
+// - Exec 不带线程池或元素数低于阈值时完全串行，小输入不付调度开销
+
+namespace day12 {
+
+enum class SimdLevel { kScalar, kAVX2, kAVX512 };
+
+inline const char *to_string(SimdLevel l) noexcept {
+    switch (l) {
+    case SimdLevel::kAVX512: return "avx512";
+    case SimdLevel::kAVX2:   return "avx2";
+    default:                 return "scalar";
+    }
+}
+
+inline SimdLevel detect_simd_level() noexcept {
+#if DAY12_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::kAVX512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::kAVX2;
+#endif
+    return SimdLevel::kScalar;
+}
+
+inline SimdLevel active_simd_level() noexcept {
+    static const SimdLevel level = detect_simd_level();
+    return level;
+}
+
+#if DAY12_X86_SIMD
+#define DAY12_AVX2   __attribute__((target("avx2,popcnt")))
+#define DAY12_AVX512 __attribute__((target("avx512f,popcnt")))
+#endif
+
+// ---- 可向量化的谓词 ----
+
+#if DAY12_X86_SIMD
+#define DAY12_PREDICATE_SIMD(avx2_expr, avx512_expr)                                   \
+    DAY12_AVX2 __m256i mask(__m256i v) const { return avx2_expr; }                     \
+    DAY12_AVX512 __mmask16 mask(__m512i v) const { return avx512_expr; }
+#else
+#define DAY12_PREDICATE_SIMD(avx2_expr, avx512_expr)
+#endif
+
+struct IsOdd {
+    bool operator()(int x) const noexcept { return (x & 1) != 0; }
+    DAY12_PREDICATE_SIMD(
+        _mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)),
+        _mm512_test_epi32_mask(v, _mm512_set1_epi32(1)))
+};
+
+struct IsEven {
+    bool operator()(int x) const noexcept { return (x & 1) == 0; }
+    DAY12_PREDICATE_SIMD(
+        _mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_set1_epi32(1)), _mm256_setzero_si256()),
+        _mm512_testn_epi32_mask(v, _mm512_set1_epi32(1)))
+};
+
+struct GreaterThan {
+    int x;
+    bool operator()(int y) const noexcept { return y > x; }
+    DAY12_PREDICATE_SIMD(
+        _mm256_cmpgt_epi32(v, _mm256_set1_epi32(x)),
+        _mm512_cmpgt_epi32_mask(v, _mm512_set1_epi32(x)))
+};
+
+struct LessThan {
+    int x;
+    bool operator()(int y) const noexcept { return y < x; }
+    DAY12_PREDICATE_SIMD(
+        _mm256_cmpgt_epi32(_mm256_set1_epi32(x), v),
+        _mm512_cmplt_epi32_mask(v, _mm512_set1_epi32(x)))
+};
+
+struct EqualTo {
+    int x;
+    bool operator()(int y) const noexcept { return y == x; }
+    DAY12_PREDICATE_SIMD(
+        _mm256_cmpeq_epi32(v, _mm256_set1_epi32(x)),
+        _mm512_cmpeq_epi32_mask(v, _mm512_set1_epi32(x)))
+};
+
+#undef DAY12_PREDICATE_SIMD
+
+// ---- 单线程内核 ----
+
+namespace scalar {
+
+template <class Pred>
+std::size_t remove_if(int *p, std::size_t n, Pred pred) {
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        int v = p[i];
+        p[out] = v;
+        out += !pred(v);
+    }
+    return out;
+}
+
+template <class Pred>
+std::size_t find_if(const int *p, std::size_t n, Pred pred) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (pred(p[i])) return i;
+    }
+    return n;
+}
+
+template <class Pred>
+std::size_t count_if(const int *p, std::size_t n, Pred pred) {
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < n; ++i) c += pred(p[i]);
+    return c;
+}
+
+} // namespace scalar
+
+#if DAY12_X86_SIMD
+
+namespace avx2 {
+
+// 保留掩码（8 位）-> 把要保留的 lane 依次排到前面的 vpermd 下标
+struct CompressTable {
+    alignas(32) std::uint32_t idx[256][8];
+    constexpr CompressTable() : idx{} {
+        for (unsigned m = 0; m < 256; ++m) {
+            unsigned k = 0;
+            for (unsigned lane = 0; lane < 8; ++lane) {
+                if (m & (1u << lane)) idx[m][k++] = lane;
+            }
+            for (; k < 8; ++k) idx[m][k] = 0;
+        }
+    }
+};
+
+inline constexpr CompressTable kCompress{};
+
+template <class Pred>
+DAY12_AVX2 std::size_t remove_if(int *p, std::size_t n, Pred pred) {
+    std::size_t out = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        auto drop = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(pred.mask(v))));
+        unsigned keep = ~drop & 0xFFu;
+        auto perm = _mm256_load_si256(reinterpret_cast<const __m256i *>(kCompress.idx[keep]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p + out), _mm256_permutevar8x32_epi32(v, perm));
+        out += static_cast<std::size_t>(__builtin_popcount(keep));
+    }
+    for (; i < n; ++i) {
+        int v = p[i];
+        p[out] = v;
+        out += !pred(v);
+    }
+    return out;
+}
+
+template <class Pred>
+DAY12_AVX2 std::size_t find_if(const int *p, std::size_t n, Pred pred) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        auto m = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(pred.mask(v))));
+        if (m) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return i + scalar::find_if(p + i, n - i, pred);
+}
+
+template <class Pred>
+DAY12_AVX2 std::size_t count_if(const int *p, std::size_t n, Pred pred) {
+    // 比较结果是 0 / -1，直接从 8 个 lane 的累加器里减掉；按 2^30 个元素分段倒出，lane 不会溢出
+    constexpr std::size_t kBlock = std::size_t{1} << 30;
+    std::size_t c = 0;
+    for (std::size_t base = 0; base < n; base += kBlock) {
+        const int *q = p + base;
+        std::size_t len = std::min(kBlock, n - base);
+        auto acc = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            acc = _mm256_sub_epi32(acc, pred.mask(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(q + i))));
+        }
+        alignas(32) std::int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+        for (auto l : lanes) c += static_cast<std::uint32_t>(l);
+        c += scalar::count_if(q + i, len - i, pred);
+    }
+    return c;
+}
+
+} // namespace avx2
+
+namespace avx512 {
+
+template <class Pred>
+DAY12_AVX512 std::size_t remove_if(int *p, std::size_t n, Pred pred) {
+    std::size_t out = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        auto v = _mm512_loadu_si512(p + i);
+        __mmask16 keep = static_cast<__mmask16>(~pred.mask(v));
+        _mm512_mask_compressstoreu_epi32(p + out, keep, v);
+        out += static_cast<std::size_t>(__builtin_popcount(keep));
+    }
+    for (; i < n; ++i) {
+        int v = p[i];
+        p[out] = v;
+        out += !pred(v);
+    }
+    return out;
+}
+
+template <class Pred>
+DAY12_AVX512 std::size_t find_if(const int *p, std::size_t n, Pred pred) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        unsigned m = pred.mask(_mm512_loadu_si512(p + i));
+        if (m) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return i + scalar::find_if(p + i, n - i, pred);
+}
+
+template <class Pred>
+DAY12_AVX512 std::size_t count_if(const int *p, std::size_t n, Pred pred) {
+    std::size_t c = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        c += static_cast<std::size_t>(__builtin_popcount(pred.mask(_mm512_loadu_si512(p + i))));
+    }
+    return c + scalar::count_if(p + i, n - i, pred);
+}
+
+} // namespace avx512
+
+#endif // DAY12_X86_SIMD
+
+// 指定一级（基准测试用）；CPU 不支持时逐级退回
+template <class Pred>
+std::size_t remove_if_n(int *p, std::size_t n, Pred pred, SimdLevel level = active_simd_level()) {
+#if DAY12_X86_SIMD
+    level = std::min(level, active_simd_level());
+    if (level == SimdLevel::kAVX512) return avx512::remove_if(p, n, pred);
+    if (level == SimdLevel::kAVX2) return avx2::remove_if(p, n, pred);
+#else
+    (void)level;
+#endif
+    return scalar::remove_if(p, n, pred);
+}
+
+template <class Pred>
+std::size_t find_if_n(const int *p, std::size_t n, Pred pred, SimdLevel level = active_simd_level()) {
+#if DAY12_X86_SIMD
+    level = std::min(level, active_simd_level());
+    if (level == SimdLevel::kAVX512) return avx512::find_if(p, n, pred);
+    if (level == SimdLevel::kAVX2) return avx2::find_if(p, n, pred);
+#else
+    (void)level;
+#endif
+    return scalar::find_if(p, n, pred);
+}
+
+template <class Pred>
+std::size_t count_if_n(const int *p, std::size_t n, Pred pred, SimdLevel level = active_simd_level()) {
+#if DAY12_X86_SIMD
+    level = std::min(level, active_simd_level());
+    if (level == SimdLevel::kAVX512) return avx512::count_if(p, n, pred);
+    if (level == SimdLevel::kAVX2) return avx2::count_if(p, n, pred);
+#else
+    (void)level;
+#endif
+    return scalar::count_if(p, n, pred);
+}
+
+// ---- 并行执行策略 ----
+
+struct Exec {
+    day14::ThreadPool *pool = nullptr;
+    std::size_t threshold = std::size_t{1} << 20;   // 少于这么多元素时串行
+
+    bool parallel(std::size_t n) const noexcept {
+        return pool && pool->thread_count() > 1 && n >= threshold;
+    }
+    std::size_t chunks(std::size_t n) const noexcept {
+        std::size_t c = pool ? pool->thread_count() * 4 : 1;
+        return std::max<std::size_t>(1, std::min(c, n / 4096));
+    }
+};
+
+namespace detail {
+
+// 把 [0, n) 切成 chunks 块，对每块调用 f(begin, end)，返回各块结果（按块顺序）
+template <class F>
+auto for_chunks(const Exec &exec, std::size_t n, F f) -> std::vector<decltype(f(std::size_t{}, std::size_t{}))> {
+    using R = decltype(f(std::size_t{}, std::size_t{}));
+    std::size_t c = exec.chunks(n);
+    std::vector<std::future<R>> futures;
+    futures.reserve(c);
+    for (std::size_t k = 0; k < c; ++k) {
+        std::size_t b = n * k / c, e = n * (k + 1) / c;
+        futures.push_back(exec.pool->submit([f, b, e]{ return f(b, e); }));
+    }
+    std::vector<R> out;
+    out.reserve(c);
+    for (auto &fu : futures) out.push_back(fu.get());
+    return out;
+}
+
+} // namespace detail
+
+template <class Pred>
+void remove_if(std::vector<int> &v, Pred pred, const Exec &exec = {}) {
+    if (!exec.parallel(v.size())) {
+        v.resize(remove_if_n(v.data(), v.size(), pred));
+        return;
+    }
+    int *p = v.data();
+    std::size_t c = exec.chunks(v.size());
+    auto kept = detail::for_chunks(exec, v.size(), [p, pred](std::size_t b, std::size_t e) {
+        return remove_if_n(p + b, e - b, pred);
+    });
+    // 各块的保留部分依次挪到前面（第一块已经就位）
+    std::size_t out = kept[0];
+    for (std::size_t k = 1; k < c; ++k) {
+        std::size_t b = v.size() * k / c;
+        std::move(p + b, p + b + kept[k], p + out);
+        out += kept[k];
+    }
+    v.resize(out);
+}
+
+// 返回第一个满足 pred 的下标，找不到返回 v.size()
+// 各块共享目前最小的命中下标 best：块内按 kFindStep 分段扫描，每段开始前看一眼 best，
+// 已有更靠前的命中就不再往后扫，前面的块一命中，后面的块很快全部停下
+template <class Pred>
+std::size_t find_if(const std::vector<int> &v, Pred pred, const Exec &exec = {}) {
+    if (!exec.parallel(v.size())) return find_if_n(v.data(), v.size(), pred);
+    static constexpr std::size_t kFindStep = 16384;
+    const int *p = v.data();
+    const std::size_t n = v.size();
+    std::atomic<std::size_t> best{n};
+    detail::for_chunks(exec, n, [p, pred, &best](std::size_t b, std::size_t e) {
+        for (std::size_t s = b; s < e; s += kFindStep) {
+            if (best.load(std::memory_order_relaxed) <= s) return 0;
+            std::size_t len = std::min(kFindStep, e - s);
+            auto i = find_if_n(p + s, len, pred);
+            if (i != len) {
+                std::size_t hit = s + i, cur = best.load(std::memory_order_relaxed);
+                while (hit < cur && !best.compare_exchange_weak(cur, hit, std::memory_order_relaxed)) {}
+                return 0;
+            }
+        }
+        return 0;
+    });
+    return best.load(std::memory_order_relaxed);
+}
+
+template <class Pred>
+std::size_t count_if(const std::vector<int> &v, Pred pred, const Exec &exec = {}) {
+    if (!exec.parallel(v.size())) return count_if_n(v.data(), v.size(), pred);
+    const int *p = v.data();
+    auto counts = detail::for_chunks(exec, v.size(), [p, pred](std::size_t b, std::size_t e) {
+        return count_if_n(p + b, e - b, pred);
+    });
+    std::size_t total = 0;
+    for (auto c : counts) total += c;
+    return total;
+}
+
+// 块内 std::sort，再逐轮两两 inplace_merge（每轮的归并也并行）
+inline void sort(std::vector<int> &v, const Exec &exec = {}) {
+    if (!exec.parallel(v.size())) {
+        std::sort(v.begin(), v.end());
+        return;
+    }
+    int *p = v.data();
+    const std::size_t n = v.size();
+    const std::size_t c = exec.chunks(n);
+    std::vector<std::size_t> bounds(c + 1);
+    for (std::size_t k = 0; k <= c; ++k) bounds[k] = n * k / c;
+    detail::for_chunks(exec, n, [p](std::size_t b, std::size_t e) {
+        std::sort(p + b, p + e);
+        return 0;
+    });
+    for (std::size_t width = 1; width < c; width *= 2) {
+        std::vector<std::future<void>> merges;
+        for (std::size_t k = 0; k + width < c; k += 2 * width) {
+            std::size_t b = bounds[k], m = bounds[k + width], e = bounds[std::min(k + 2 * width, c)];
+            merges.push_back(exec.pool->submit([p, b, m, e]{ std::inplace_merge(p + b, p + m, p + e); }));
+        }
+        for (auto &f : merges) f.get();
+    }
+}
+
+// ---- training/test1.cpp 的同名接口 ----
+
+inline void remove_odd(std::vector<int> &v, const Exec &exec = {}) { remove_if(v, IsOdd{}, exec); }
+
+inline std::optional<int> find_first_even(const std::vector<int> &v, const Exec &exec = {}) {
+    auto i = find_if(v, IsEven{}, exec);
+    if (i == v.size()) return std::nullopt;
+    return v[i];
+}
+
+inline std::size_t count_greater_than(const std::vector<int> &v, int x, const Exec &exec = {}) {
+    return count_if(v, GreaterThan{x}, exec);
+}
+
+} // namespace day12
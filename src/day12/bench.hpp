@@ -0,0 +1,550 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <time.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DAY12_BENCH_TSC 1
+#include <cpuid.h>
+#include <x86intrin.h>
+#else
+#define DAY12_BENCH_TSC 0
+#endif
+
+// 微基准框架：取代 test1 的 Timer（毫秒、单次）和 day12.md 里手写的 bench()
+// 典型用法：
+//   int main(int argc, char **argv) {
+//       day12::Bench bench(day12::BenchOptions::from_args(argc, argv));
+//       bench.run("push_back/reserve", [&]{
+//           std::vector<int> v; v.reserve(n);
+//           for (int i = 0; i < n; ++i) v.push_back(i);
+//           day12::do_not_optimize(v.data());
+//       });
+//       bench.run("sort", [&](std::uint64_t iters) {   // 批量形式：准备工作不计时
+//           ...
+//       });
+//       return bench.finish();   // 打印表格，按选项写 JSON/CSV、对比基线；有回归返回 1
+//   }
+//   ./prog --csv=base.csv             # 保存基线
+//   ./prog --baseline=base.csv        # 之后的运行与之对比，中位数变慢超过阈值记为回归
+//
+// 设计要点：
+// - 计时源：x86 上 TSC 为 invariant 时用 rdtsc（开头 lfence，结尾 rdtscp），
+//   启动时对照 clock_gettime(CLOCK_MONOTONIC_RAW) 校准出每 tick 的纳秒数；否则直接用 clock_gettime
+// - 自动定迭代次数：每个样本（一批连续调用）至少跑 min_sample_ns，迭代数按上一批耗时外推放大；
+//   这段探测本身计入预热，预热至少 warmup_ns，让 cache、分支预测、CPU 频率都进入稳态
+// - 每个基准取 samples 个样本（每个样本的 ns/op），报告 min / median / mean / stddev / p99 / max；
+//   以中位数为主指标，受偶发的调度、中断干扰最小
+// - do_not_optimize / clobber_memory 是空的内联汇编屏障：前者让编译器认为值被读过（不能整段删掉），
+//   后者让编译器认为内存被任意改写（不能把循环里的存储合并或提到循环外）
+// - run_concurrent 测多线程负载：各线程同时起跑，统计抽样的单操作延迟分位数，吞吐量按墙钟时间算
+// - 基线就是上一次 --csv 的输出，按名字匹配；同名基准中位数变慢超过 threshold% 即判为回归
+
+namespace day12 {
+
+template <class T>
+inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+template <class T>
+inline void do_not_optimize(T &value) {
+#if defined(__clang__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#elif defined(__GNUC__)
+    // GCC 在某些优化组合下对 "+r,m" 报 impossible constraint，把内存约束放在前面
+    asm volatile("" : "+m,r"(value) : : "memory");
+#else
+    static volatile void *sink;
+    sink = &value;
+#endif
+}
+
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+enum class BenchClock { kAuto, kTsc, kMonotonic };
+
+inline std::uint64_t monotonic_ns() noexcept {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ull +
+           static_cast<std::uint64_t>(ts.tv_nsec);
+}
+
+#if DAY12_BENCH_TSC
+// 计时区间开头：lfence 挡住前面的指令，不让它们越过 rdtsc 落进计时区间之外
+inline std::uint64_t tsc_begin() noexcept {
+    _mm_lfence();
+    std::uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+
+// 计时区间结尾：rdtscp 等前面的指令都执行完才读，lfence 挡住后面的指令提前执行
+inline std::uint64_t tsc_end() noexcept {
+    unsigned aux;
+    std::uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+}
+
+// CPUID.80000007H:EDX[8]：TSC 频率恒定，不随 P-state / C-state 变化
+inline bool has_invariant_tsc() noexcept {
+    unsigned a, b, c, d;
+    if (!__get_cpuid(0x80000000u, &a, &b, &c, &d) || a < 0x80000007u) return false;
+    __get_cpuid(0x80000007u, &a, &b, &c, &d);
+    return (d >> 8) & 1u;
+}
+#endif
+
+// 计时器：begin()/end() 返回原始读数（TSC tick 或纳秒），ns() 换算成纳秒
+class BenchTimer {
+public:
+    explicit BenchTimer(BenchClock clock = BenchClock::kAuto) {
+#if DAY12_BENCH_TSC
+        use_tsc_ = clock == BenchClock::kTsc ||
+                   (clock == BenchClock::kAuto && has_invariant_tsc());
+        if (use_tsc_) calibrate();
+#else
+        (void)clock;
+#endif
+    }
+
+    std::uint64_t begin() const noexcept {
+#if DAY12_BENCH_TSC
+        if (use_tsc_) return tsc_begin();
+#endif
+        return monotonic_ns();
+    }
+
+    std::uint64_t end() const noexcept {
+#if DAY12_BENCH_TSC
+        if (use_tsc_) return tsc_end();
+#endif
+        return monotonic_ns();
+    }
+
+    double ns(std::uint64_t from, std::uint64_t to) const noexcept {
+        return static_cast<double>(to - from) * ns_per_tick_;
+    }
+
+    bool uses_tsc() const noexcept { return use_tsc_; }
+    double ns_per_tick() const noexcept { return ns_per_tick_; }
+
+private:
+#if DAY12_BENCH_TSC
+    // 在 ~20ms 的窗口两端同时读 TSC 和单调时钟，取三次里最短窗口的比值
+    void calibrate() {
+        double best = 0.0;
+        std::uint64_t best_window = ~0ull;
+        for (int round = 0; round < 3; ++round) {
+            auto n0 = monotonic_ns();
+            auto t0 = tsc_begin();
+            auto n1 = n0;
+            while (n1 - n0 < 20000000ull) n1 = monotonic_ns();
+            auto t1 = tsc_end();
+            auto window = n1 - n0;
+            if (t1 > t0 && window < best_window) {
+                best_window = window;
+                best = static_cast<double>(window) / static_cast<double>(t1 - t0);
+            }
+        }
+        if (best > 0.0) ns_per_tick_ = best;
+        else use_tsc_ = false;
+    }
+#endif
+
+    bool use_tsc_ = false;
+    double ns_per_tick_ = 1.0;
+};
+
+// 一组样本（单位 ns/op）的统计量
+struct BenchStats {
+    double min_ns = 0, median_ns = 0, mean_ns = 0, stddev_ns = 0, p99_ns = 0, max_ns = 0;
+
+    // 线性插值分位数；p 取值 [0, 1]，sorted 必须已升序
+    static double percentile(const std::vector<double> &sorted, double p) {
+        if (sorted.empty()) return 0.0;
+        double pos = p * static_cast<double>(sorted.size() - 1);
+        auto lo = static_cast<std::size_t>(pos);
+        auto hi = std::min(lo + 1, sorted.size() - 1);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - static_cast<double>(lo));
+    }
+
+    static BenchStats from(std::vector<double> samples) {
+        BenchStats s;
+        if (samples.empty()) return s;
+        std::sort(samples.begin(), samples.end());
+        double sum = 0.0;
+        for (double x : samples) sum += x;
+        s.mean_ns = sum / static_cast<double>(samples.size());
+        double sq = 0.0;
+        for (double x : samples) sq += (x - s.mean_ns) * (x - s.mean_ns);
+        s.stddev_ns = samples.size() > 1 ? std::sqrt(sq / static_cast<double>(samples.size() - 1)) : 0.0;
+        s.min_ns = samples.front();
+        s.max_ns = samples.back();
+        s.median_ns = percentile(samples, 0.50);
+        s.p99_ns = percentile(samples, 0.99);
+        return s;
+    }
+};
+
+struct BenchResult {
+    std::string name;
+    std::uint64_t iterations = 0;   // 每个样本的调用次数（run_concurrent 为总操作数）
+    std::size_t samples = 0;
+    BenchStats stats;
+    double wall_ops_per_sec = 0;    // 并发负载：总操作数 / 墙钟时间；0 表示按中位数换算
+
+    double ops_per_sec() const noexcept {
+        if (wall_ops_per_sec > 0) return wall_ops_per_sec;
+        // 低于 1ps/op 说明被测体已被优化掉，吞吐量没有意义
+        return stats.median_ns > 1e-3 ? 1e9 / stats.median_ns : 0.0;
+    }
+};
+
+struct BenchOptions {
+    std::size_t samples = 31;
+    std::uint64_t min_sample_ns = 2000000;     // 每个样本至少 2ms
+    std::uint64_t warmup_ns = 100000000;       // 每个基准至少预热 100ms
+    BenchClock clock = BenchClock::kAuto;
+    std::string filter;                        // 只跑名字包含该子串的基准
+    std::string json_path, csv_path, baseline_path;
+    double threshold_pct = 5.0;                // 中位数比基线慢超过该比例视为回归
+
+    // 认识 --samples= --min-time-ms= --warmup-ms= --clock=tsc|mono --filter=
+    //      --json= --csv= --baseline= --threshold=；其余参数忽略，留给调用方
+    static BenchOptions from_args(int argc, char **argv) {
+        BenchOptions o;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto eq = arg.find('=');
+            if (arg.compare(0, 2, "--") != 0 || eq == std::string::npos) continue;
+            auto key = arg.substr(2, eq - 2);
+            auto val = arg.substr(eq + 1);
+            if (key == "samples") o.samples = std::max<std::size_t>(1, std::strtoul(val.c_str(), nullptr, 10));
+            else if (key == "min-time-ms") o.min_sample_ns = static_cast<std::uint64_t>(std::strtod(val.c_str(), nullptr) * 1e6);
+            else if (key == "warmup-ms") o.warmup_ns = static_cast<std::uint64_t>(std::strtod(val.c_str(), nullptr) * 1e6);
+            else if (key == "clock") o.clock = val == "tsc" ? BenchClock::kTsc
+                                             : val == "mono" ? BenchClock::kMonotonic : BenchClock::kAuto;
+            else if (key == "filter") o.filter = val;
+            else if (key == "json") o.json_path = val;
+            else if (key == "csv") o.csv_path = val;
+            else if (key == "baseline") o.baseline_path = val;
+            else if (key == "threshold") o.threshold_pct = std::strtod(val.c_str(), nullptr);
+        }
+        return o;
+    }
+};
+
+class Bench {
+public:
+    explicit Bench(BenchOptions opts = {}) : opts_(std::move(opts)), timer_(opts_.clock) {}
+
+    // f() 是一次操作；或 f(iters) 自己循环 iters 次（循环外的准备工作不计时）
+    template <class F>
+    const BenchResult *run(const std::string &name, F &&f) {
+        if (!selected(name)) return nullptr;
+
+        auto batch = [&](std::uint64_t iters) {
+            if constexpr (std::is_invocable_v<F&, std::uint64_t>) {
+                auto t0 = timer_.begin();
+                f(iters);
+                return timer_.ns(t0, timer_.end());
+            } else {
+                auto t0 = timer_.begin();
+                for (std::uint64_t i = 0; i < iters; ++i) f();
+                return timer_.ns(t0, timer_.end());
+            }
+        };
+
+        // 预热 + 定迭代数：翻倍（或按耗时外推，最多 x10）直到一批够长、且预热时间够了
+        std::uint64_t iters = 1;
+        double spent = 0.0;
+        for (;;) {
+            double t = batch(iters);
+            spent += t;
+            auto target = static_cast<double>(opts_.min_sample_ns);
+            if (t >= target && spent >= static_cast<double>(opts_.warmup_ns)) break;
+            // 被测体被整个优化掉时批耗时不随 iters 增长，到上限就停，结果接近 0 本身就是提示
+            if (iters >= kMaxIterations) break;
+            if (t < target) {
+                double grow = t > 0 ? target * 1.2 / t : 10.0;
+                iters = static_cast<std::uint64_t>(static_cast<double>(iters) *
+                                                   std::clamp(grow, 2.0, 10.0));
+                iters = std::min(iters, kMaxIterations);
+            }
+        }
+
+        std::vector<double> per_op;
+        per_op.reserve(opts_.samples);
+        for (std::size_t s = 0; s < opts_.samples; ++s) {
+            per_op.push_back(batch(iters) / static_cast<double>(iters));
+        }
+        return &add(BenchResult{name, iters, per_op.size(), BenchStats::from(std::move(per_op))});
+    }
+
+    // 并发负载：threads 个线程同时起跑，各自调用 op(thread, i) ops_per_thread 次。
+    // 每 sample_every 次取一次单操作延迟进统计（计时本身也有开销，不逐个记），
+    // 吞吐量 = 总操作数 / 墙钟时间。正式计时前先以 1/10 的操作数跑一轮预热
+    template <class Op>
+    const BenchResult *run_concurrent(const std::string &name, unsigned threads,
+                                      std::uint64_t ops_per_thread, Op &&op,
+                                      unsigned sample_every = 8) {
+        if (!selected(name)) return nullptr;
+        threads = std::max(1u, threads);
+        sample_every = std::max(1u, sample_every);
+
+        std::vector<std::vector<double>> lat(threads);
+        auto round = [&](std::uint64_t ops, bool record) {
+            std::atomic<unsigned> ready{0};
+            std::atomic<bool> go{false};
+            std::vector<std::thread> ts;
+            ts.reserve(threads);
+            for (unsigned t = 0; t < threads; ++t) {
+                ts.emplace_back([&, t]{
+                    auto &mine = lat[t];
+                    if (record) mine.reserve(ops / sample_every + 1);
+                    ready.fetch_add(1, std::memory_order_release);
+                    while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                    for (std::uint64_t i = 0; i < ops; ++i) {
+                        if (record && i % sample_every == 0) {
+                            auto t0 = timer_.begin();
+                            op(t, i);
+                            mine.push_back(timer_.ns(t0, timer_.end()));
+                        } else {
+                            op(t, i);
+                        }
+                    }
+                });
+            }
+            while (ready.load(std::memory_order_acquire) < threads) std::this_thread::yield();
+            auto w0 = monotonic_ns();
+            go.store(true, std::memory_order_release);
+            for (auto &th : ts) th.join();
+            return static_cast<double>(monotonic_ns() - w0);
+        };
+
+        round(std::max<std::uint64_t>(1, ops_per_thread / 10), false);
+        double wall_ns = round(ops_per_thread, true);
+
+        std::vector<double> all;
+        for (auto &v : lat) all.insert(all.end(), v.begin(), v.end());
+        BenchResult r{name, ops_per_thread * threads, all.size(), BenchStats::from(std::move(all))};
+        r.wall_ops_per_sec = wall_ns > 0 ? static_cast<double>(r.iterations) * 1e9 / wall_ns : 0.0;
+        return &add(std::move(r));
+    }
+
+    // 外部自己测的结果（例如多线程负载里逐操作记下的延迟）也并入同一份报告
+    const BenchResult &add(BenchResult r) {
+        print_row(std::cout, r);
+        results_.push_back(std::move(r));
+        return results_.back();
+    }
+
+    bool selected(const std::string &name) const {
+        return opts_.filter.empty() || name.find(opts_.filter) != std::string::npos;
+    }
+
+    const std::deque<BenchResult> &results() const noexcept { return results_; }
+    const BenchOptions &options() const noexcept { return opts_; }
+    const BenchTimer &timer() const noexcept { return timer_; }
+
+    void write_json(std::ostream &os) const {
+        os << std::setprecision(10) << "{\n  \"clock\": \"" << (timer_.uses_tsc() ? "tsc" : "clock_gettime") << "\",\n"
+           << "  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const auto &r = results_[i];
+            os << (i ? ",\n" : "\n") << "    {\"name\": \"" << json_escape(r.name) << "\""
+               << ", \"iterations\": " << r.iterations << ", \"samples\": " << r.samples
+               << ", \"min_ns\": " << r.stats.min_ns << ", \"median_ns\": " << r.stats.median_ns
+               << ", \"mean_ns\": " << r.stats.mean_ns << ", \"stddev_ns\": " << r.stats.stddev_ns
+               << ", \"p99_ns\": " << r.stats.p99_ns << ", \"max_ns\": " << r.stats.max_ns
+               << ", \"ops_per_sec\": " << r.ops_per_sec() << "}";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+    void write_csv(std::ostream &os) const {
+        os << std::setprecision(10) << "name,iterations,samples,min_ns,median_ns,mean_ns,stddev_ns,p99_ns,max_ns,ops_per_sec\n";
+        for (const auto &r : results_) {
+            os << csv_quote(r.name) << ',' << r.iterations << ',' << r.samples << ','
+               << r.stats.min_ns << ',' << r.stats.median_ns << ',' << r.stats.mean_ns << ','
+               << r.stats.stddev_ns << ',' << r.stats.p99_ns << ',' << r.stats.max_ns << ','
+               << r.ops_per_sec() << '\n';
+        }
+    }
+
+    // 读 write_csv 的输出，返回 名字 -> 中位数 ns/op；文件打不开返回空表
+    static std::map<std::string, double> load_baseline(const std::string &path) {
+        std::map<std::string, double> base;
+        std::ifstream in(path);
+        std::string line;
+        std::getline(in, line); // 表头
+        while (std::getline(in, line)) {
+            std::size_t pos = 0;
+            auto name = csv_unquote(line, pos);
+            // 跳过 iterations, samples, min_ns 三列，第四列是 median_ns
+            for (int col = 0; col < 3 && pos != std::string::npos; ++col) {
+                pos = line.find(',', pos + 1);
+            }
+            if (pos == std::string::npos) continue;
+            base[name] = std::strtod(line.c_str() + pos + 1, nullptr);
+        }
+        return base;
+    }
+
+    // 与基线逐项对比，返回回归项个数
+    std::size_t compare(const std::map<std::string, double> &base, std::ostream &os) const {
+        std::size_t regressions = 0;
+        os << "\n对比基线（阈值 " << opts_.threshold_pct << "%）:\n";
+        for (const auto &r : results_) {
+            auto it = base.find(r.name);
+            os << "  " << std::left << std::setw(name_width()) << r.name << std::right;
+            if (it == base.end() || !(it->second > 0)) {
+                os << "  (基线中没有)\n";
+                continue;
+            }
+            double delta = (r.stats.median_ns - it->second) / it->second * 100.0;
+            bool bad = delta > opts_.threshold_pct;
+            regressions += bad;
+            os << "  " << std::fixed << std::setprecision(2) << std::setw(10) << it->second
+               << " -> " << std::setw(10) << r.stats.median_ns << " ns  "
+               << std::showpos << std::setprecision(1) << delta << "%" << std::noshowpos
+               << std::defaultfloat << (bad ? "  REGRESSION" : "") << "\n";
+        }
+        return regressions;
+    }
+
+    // 收尾：按选项写文件、对比基线；返回值可直接作为 main 的退出码
+    int finish() const {
+        if (!opts_.json_path.empty()) {
+            std::ofstream out(opts_.json_path);
+            write_json(out);
+        }
+        if (!opts_.csv_path.empty()) {
+            std::ofstream out(opts_.csv_path);
+            write_csv(out);
+        }
+        if (opts_.baseline_path.empty()) return 0;
+        auto base = load_baseline(opts_.baseline_path);
+        if (base.empty()) {
+            std::cerr << "无法读取基线 " << opts_.baseline_path << "\n";
+            return 1;
+        }
+        return compare(base, std::cout) ? 1 : 0;
+    }
+
+    static void print_header(std::ostream &os, int width = 44) {
+        os << std::left << std::setw(width) << "benchmark" << std::right
+           << std::setw(12) << "median ns" << std::setw(12) << "p99 ns"
+           << std::setw(10) << "stddev" << std::setw(14) << "ops/s"
+           << std::setw(15) << "iters" << "\n";
+    }
+
+private:
+    static constexpr std::uint64_t kMaxIterations = std::uint64_t{1} << 40;
+
+    int name_width() const {
+        std::size_t w = 44;
+        for (const auto &r : results_) w = std::max(w, r.name.size() + 2);
+        return static_cast<int>(w);
+    }
+
+    void print_row(std::ostream &os, const BenchResult &r) {
+        if (!header_printed_) {
+            os << "clock: " << (timer_.uses_tsc() ? "rdtsc" : "clock_gettime");
+            if (timer_.uses_tsc()) os << " (" << 1.0 / timer_.ns_per_tick() << " GHz)";
+            os << ", samples=" << opts_.samples << "\n";
+            print_header(os);
+            header_printed_ = true;
+        }
+        auto flags = os.flags();
+        auto prec = os.precision();
+        os << std::left << std::setw(44) << r.name << std::right << std::fixed << std::setprecision(2)
+           << std::setw(12) << r.stats.median_ns << std::setw(12) << r.stats.p99_ns
+           << std::setw(10) << r.stats.stddev_ns << std::setprecision(0)
+           << std::setw(14) << r.ops_per_sec() << std::setw(15) << r.iterations << "\n";
+        os.flags(flags);
+        os.precision(prec);
+    }
+
+    static std::string json_escape(const std::string &s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') out += '\\';
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+                continue;
+            }
+            out += c;
+        }
+        return out;
+    }
+
+    static std::string csv_quote(const std::string &s) {
+        if (s.find_first_of(",\"\n") == std::string::npos) return s;
+        std::string out = "\"";
+        for (char c : s) {
+            if (c == '"') out += '"';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    // 解析第一列；pos 返回其后逗号的位置
+    static std::string csv_unquote(const std::string &line, std::size_t &pos) {
+        if (line.empty() || line[0] != '"') {
+            pos = line.find(',');
+            return line.substr(0, pos);
+        }
+        std::string out;
+        std::size_t i = 1;
+        for (; i < line.size(); ++i) {
+            if (line[i] == '"') {
+                if (i + 1 < line.size() && line[i + 1] == '"') { out += '"'; ++i; }
+                else { ++i; break; }
+            } else {
+                out += line[i];
+            }
+        }
+        pos = i < line.size() && line[i] == ',' ? i : std::string::npos;
+        return out;
+    }
+
+    BenchOptions opts_;
+    BenchTimer timer_;
+    std::deque<BenchResult> results_;   // deque：run/add 返回的引用不会因后续追加失效
+    bool header_printed_ = false;
+};
+
+} // namespace day12
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+// day12.md 里的几个对比，改用 bench.hpp 重写：
+//   reserve vs 不 reserve、vector vs list 顺序遍历、do_not_optimize 的作用
+// 参数见 BenchOptions::from_args，例如：
+//   ./bench_demo --csv=base.csv
+//   ./bench_demo --baseline=base.csv --threshold=10
+
+int main(int argc, char **argv) {
+    day12::Bench bench(day12::BenchOptions::from_args(argc, argv));
+    const int n = 100000;
+
+    bench.run("push_back/no_reserve", [&]{
+        std::vector<int> v;
+        for (int i = 0; i < n; ++i) v.push_back(i);
+        day12::do_not_optimize(v.data());
+    });
+
+    bench.run("push_back/reserve", [&]{
+        std::vector<int> v;
+        v.reserve(n);
+        for (int i = 0; i < n; ++i) v.push_back(i);
+        day12::do_not_optimize(v.data());
+    });
+
+    bench.run("push_back/string/no_reserve", [&]{
+        std::vector<std::string> v;
+        for (int i = 0; i < n / 10; ++i) v.emplace_back("a string longer than SSO");
+        day12::do_not_optimize(v.data());
+    });
+
+    bench.run("push_back/string/reserve", [&]{
+        std::vector<std::string> v;
+        v.reserve(n / 10);
+        for (int i = 0; i < n / 10; ++i) v.emplace_back("a string longer than SSO");
+        day12::do_not_optimize(v.data());
+    });
+
+    std::vector<int> vec(n);
+    std::iota(vec.begin(), vec.end(), 0);
+    std::list<int> lst(vec.begin(), vec.end());
+    bench.run("traverse/vector", [&]{
+        long sum = std::accumulate(vec.begin(), vec.end(), 0L);
+        day12::do_not_optimize(sum);
+    });
+    bench.run("traverse/list", [&]{
+        long sum = std::accumulate(lst.begin(), lst.end(), 0L);
+        day12::do_not_optimize(sum);
+    });
+
+    // 批量形式：工作缓冲每批只分配一次；排序前必须恢复乱序，copy+sort 减去 copy 才是排序本身
+    std::mt19937 rng(1);
+    std::vector<int> shuffled = vec;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    bench.run("copy", [&](std::uint64_t iters) {
+        std::vector<int> work(shuffled.size());
+        for (std::uint64_t i = 0; i < iters; ++i) {
+            std::copy(shuffled.begin(), shuffled.end(), work.begin());
+            day12::clobber_memory();
+        }
+    });
+    bench.run("copy+sort", [&](std::uint64_t iters) {
+        std::vector<int> work(shuffled.size());
+        for (std::uint64_t i = 0; i < iters; ++i) {
+            std::copy(shuffled.begin(), shuffled.end(), work.begin());
+            std::sort(work.begin(), work.end());
+            day12::do_not_optimize(work.data());
+        }
+    });
+
+    // 没有屏障时，-O2 下整段求和可能被算成常量甚至删掉，测出来接近 0
+    bench.run("sum/no_barrier", [&]{
+        long sum = 0;
+        for (int i = 0; i < 1000; ++i) sum += i;
+        (void)sum;
+    });
+    bench.run("sum/do_not_optimize", [&]{
+        long sum = 0;
+        for (int i = 0; i < 1000; ++i) {
+            sum += i;
+            day12::do_not_optimize(sum);
+        }
+    });
+
+    return bench.finish();
+}
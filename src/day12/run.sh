@@ -0,0 +1,52 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "${BASH_SOURCE[0]%/*}" && pwd)"
+BUILD_DIR="${SCRIPT_DIR}/../build/day12"
+SRC_DIR="${SCRIPT_DIR}"
+
+usage() {
+  cat <<'EOF'
+用法: ./run.sh [algo|bench|suite|all] [基准参数...]
+  algo  编译运行 SIMD / 并行算法基准（remove_if、find_if、count_if、sort，对比 std:: 串行版本）
+  bench 编译运行微基准框架示例（reserve、vector vs list、do_not_optimize），
+        之后的参数原样传给程序，如 --csv=base.csv / --baseline=base.csv / --filter=reserve
+  suite 编译运行并发组件基准（LRU、线程池、队列 ping-pong、调度器定时器），
+        额外认识 --max-threads=N / --ops=N，其余参数同 bench
+  all   编译运行全部示例（默认）
+EOF
+}
+
+build() {
+  mkdir -p "${BUILD_DIR}"
+  local target="$1" src="$2"; shift 2
+  echo "[BUILD] ${src} -> ${target}"
+  g++ -std=c++17 -O0 -g -Wall -Wextra -pedantic -pthread "$@" \
+      "${SRC_DIR}/${src}" -o "${BUILD_DIR}/${target}"
+}
+
+run_algo() {
+  build "algo_bench" "algo_bench.cpp" -O2
+  echo "[RUN ] algo_bench" && "${BUILD_DIR}/algo_bench"
+}
+
+run_bench() {
+  build "bench_demo" "bench_demo.cpp" -O2
+  echo "[RUN ] bench_demo" && "${BUILD_DIR}/bench_demo" "$@"
+}
+
+run_suite() {
+  build "suite_bench" "suite_bench.cpp" -O2
+  echo "[RUN ] suite_bench" && "${BUILD_DIR}/suite_bench" "$@"
+}
+
+choice=${1:-all}
+shift || true
+case "${choice}" in
+  algo)  run_algo ;;
+  bench) run_bench "$@" ;;
+  suite) run_suite "$@" ;;
+  all)   run_algo; run_bench; run_suite ;;
+  -h|--help) usage ;;
+  *) usage; exit 1 ;;
+esac
@@ -0,0 +1,297 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench.hpp"
+#include "../day7/lru_cache.hpp"
+#include "../day8/blocking_queue.hpp"
+#include "../day8/mpmc_queue.hpp"
+#include "../day14/scheduler.hpp"
+#include "../day14/sharded_scheduler.hpp"
+
+// 并发组件基准：LRU 缓存、线程池、生产者/消费者队列、调度器，在不同线程数下测吞吐量和延迟分位数
+//   lru/*      Zipf(0.99) 分布的 90% get / 10% put；一把全局锁 vs 按 key 分 16 片各自加锁
+//   pool/*     大量极小任务同时 submit（每个任务只做一次原子加），对比 try_submit_bulk 批量投递
+//   pingpong/* 成对线程经两个队列来回传一个数，记往返延迟（MPMCQueue vs BlockingQueue）
+//   sched/*    定时器频繁创建又取消（请求超时的典型用法）、以及反复 reschedule 续期
+// 除 bench.hpp 的参数外还认识 --max-threads=N（默认 max(4, 核数)）和 --ops=N（每线程操作数）
+// 例：./suite_bench --filter=lru --csv=base.csv；改完代码后 ./suite_bench --baseline=base.csv
+
+namespace {
+
+// Zipf 分布：预先算好 CDF，取样时二分查找；只在计时之前用来生成 key 序列
+class Zipf {
+public:
+    Zipf(std::uint32_t n, double s) : cdf_(n) {
+        double sum = 0.0;
+        for (std::uint32_t k = 0; k < n; ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), s);
+            cdf_[k] = sum;
+        }
+        for (auto &c : cdf_) c /= sum;
+    }
+
+    template <class Rng>
+    std::uint32_t operator()(Rng &rng) {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        auto it = std::lower_bound(cdf_.begin(), cdf_.end(), u);
+        return static_cast<std::uint32_t>(std::min<std::ptrdiff_t>(it - cdf_.begin(),
+                                                                   static_cast<std::ptrdiff_t>(cdf_.size()) - 1));
+    }
+
+private:
+    std::vector<double> cdf_;
+};
+
+struct SuiteConfig {
+    unsigned max_threads = std::max(4u, std::thread::hardware_concurrency());
+    std::uint64_t ops = 100000;
+
+    static SuiteConfig from_args(int argc, char **argv) {
+        SuiteConfig c;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg.rfind("--max-threads=", 0) == 0) c.max_threads = std::max(1, std::atoi(arg.c_str() + 14));
+            else if (arg.rfind("--ops=", 0) == 0) c.ops = std::max(10ll, std::atoll(arg.c_str() + 6));
+        }
+        return c;
+    }
+
+    std::vector<unsigned> thread_counts() const {
+        std::vector<unsigned> v;
+        for (unsigned t = 1; t < max_threads; t *= 2) v.push_back(t);
+        v.push_back(max_threads);
+        return v;
+    }
+};
+
+std::string with_threads(const std::string &name, unsigned threads) {
+    return name + "/threads:" + std::to_string(threads);
+}
+
+// ---- LRU ----
+
+constexpr std::uint32_t kKeySpace = 100000;
+constexpr std::size_t kCacheCap = 10000;
+constexpr std::size_t kShards = 16;
+
+using Cache = day7::LRUCache<std::uint32_t, std::uint64_t>;
+
+struct LockedCache {
+    explicit LockedCache(std::size_t cap) : cache(cap) {}
+    std::mutex mtx;
+    Cache cache;
+};
+
+struct alignas(day8::kCacheLine) CacheShard : LockedCache {
+    CacheShard() : LockedCache(kCacheCap / kShards) {}
+};
+
+inline std::size_t shard_of(std::uint32_t key) noexcept {
+    return (key * 0x9E3779B1u) >> 28; // 高 4 位：16 片
+}
+
+inline void lru_op(LockedCache &c, std::uint32_t key, std::uint64_t i) {
+    std::lock_guard<std::mutex> lock(c.mtx);
+    if (i % 10 == 0) {
+        c.cache.put(key, i);
+    } else {
+        auto v = c.cache.get(key);
+        day12::do_not_optimize(v);
+    }
+}
+
+void bench_lru(day12::Bench &bench, const SuiteConfig &cfg) {
+    // 每个线程一条独立的 key 序列，提前生成，计时里只剩缓存操作本身
+    Zipf zipf(kKeySpace, 0.99);
+    std::vector<std::vector<std::uint32_t>> keys(cfg.max_threads);
+    for (unsigned t = 0; t < cfg.max_threads; ++t) {
+        std::mt19937 rng(t + 1);
+        keys[t].resize(cfg.ops);
+        for (auto &k : keys[t]) k = zipf(rng);
+    }
+
+    for (unsigned threads : cfg.thread_counts()) {
+        LockedCache global(kCacheCap);
+        for (std::uint32_t k = 0; k < kCacheCap; ++k) global.cache.put(k, k);
+        bench.run_concurrent(with_threads("lru/global_mutex", threads), threads, cfg.ops,
+                             [&](unsigned t, std::uint64_t i) { lru_op(global, keys[t][i], i); });
+
+        std::vector<CacheShard> shards(kShards);
+        for (std::uint32_t k = 0; k < kCacheCap; ++k) shards[shard_of(k)].cache.put(k, k);
+        bench.run_concurrent(with_threads("lru/sharded16", threads), threads, cfg.ops,
+                             [&](unsigned t, std::uint64_t i) {
+                                 auto key = keys[t][i];
+                                 lru_op(shards[shard_of(key)], key, i);
+                             });
+    }
+}
+
+// ---- ThreadPool ----
+
+void wait_drained(const std::atomic<std::uint64_t> &done, const std::atomic<std::uint64_t> &submitted) {
+    while (done.load(std::memory_order_acquire) < submitted.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+void bench_pool(day12::Bench &bench, const SuiteConfig &cfg) {
+    unsigned workers = std::max(2u, std::thread::hardware_concurrency());
+    day14::ThreadPool pool(workers, 4096);
+    std::atomic<std::uint64_t> submitted{0}, done{0};
+    auto tiny = [&done]{ done.fetch_add(1, std::memory_order_relaxed); };
+
+    for (unsigned threads : cfg.thread_counts()) {
+        bench.run_concurrent(with_threads("pool/submit", threads), threads, cfg.ops,
+                             [&](unsigned, std::uint64_t) {
+                                 submitted.fetch_add(1, std::memory_order_relaxed);
+                                 auto f = pool.submit(tiny);
+                                 (void)f;
+                             });
+        wait_drained(done, submitted);
+
+        // 一次操作 = 投递 64 个任务；放不下的部分让出 CPU 后接着投
+        constexpr std::size_t kBatch = 64;
+        bench.run_concurrent(with_threads("pool/submit_bulk64", threads), threads, cfg.ops / kBatch + 1,
+                             [&](unsigned, std::uint64_t) {
+                                 std::array<day14::PoolTask, kBatch> batch;
+                                 for (auto &task : batch) task.fn = tiny;
+                                 submitted.fetch_add(kBatch, std::memory_order_relaxed);
+                                 auto first = batch.begin();
+                                 while (first != batch.end()) {
+                                     first += static_cast<std::ptrdiff_t>(pool.try_submit_bulk(first, batch.end()));
+                                     if (first != batch.end()) std::this_thread::yield();
+                                 }
+                             }, 1);
+        wait_drained(done, submitted);
+    }
+}
+
+// ---- 队列 ping-pong ----
+
+inline void q_push(day8::MPMCQueue<std::uint64_t> &q, std::uint64_t v) { q.push(v); }
+inline void q_pop(day8::MPMCQueue<std::uint64_t> &q, std::uint64_t &v) { q.pop(v); }
+inline void q_push(day8::BlockingQueue<std::uint64_t> &q, std::uint64_t v) { q.push(v); }
+inline void q_pop(day8::BlockingQueue<std::uint64_t> &q, std::uint64_t &v) { q.pop(v); }
+
+// pairs 个 ping 线程向 there 发一个数、等 back 回来；pairs 个 pong 线程原样转发。
+// 每个 ping 同时只有一个数在途，总发出数 == 总转发数，谁也不会永久阻塞。
+// 只有 ping 端的往返延迟有意义，所以不用 run_concurrent，自己计时后 add 进报告
+template <class Queue>
+void ping_pong(day12::Bench &bench, const std::string &name, unsigned pairs, std::uint64_t rounds) {
+    if (!bench.selected(name)) return;
+    Queue there(1024), back(1024);
+    const auto &timer = bench.timer();
+    std::vector<std::vector<double>> rtt(pairs);
+    std::atomic<bool> go{false};
+    std::vector<std::thread> ts;
+    for (unsigned p = 0; p < pairs; ++p) {
+        rtt[p].reserve(rounds);
+        ts.emplace_back([&, p]{
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            std::uint64_t v = 0;
+            for (std::uint64_t i = 0; i < rounds; ++i) {
+                auto t0 = timer.begin();
+                q_push(there, i);
+                q_pop(back, v);
+                rtt[p].push_back(timer.ns(t0, timer.end()));
+            }
+        });
+        ts.emplace_back([&]{
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            std::uint64_t v = 0;
+            for (std::uint64_t i = 0; i < rounds; ++i) {
+                q_pop(there, v);
+                q_push(back, v);
+            }
+        });
+    }
+    auto w0 = day12::monotonic_ns();
+    go.store(true, std::memory_order_release);
+    for (auto &t : ts) t.join();
+    auto wall = static_cast<double>(day12::monotonic_ns() - w0);
+
+    std::vector<double> all;
+    for (auto &v : rtt) all.insert(all.end(), v.begin(), v.end());
+    day12::BenchResult r{name, rounds * pairs, all.size(), day12::BenchStats::from(std::move(all))};
+    r.wall_ops_per_sec = static_cast<double>(r.iterations) * 1e9 / wall;
+    bench.add(std::move(r));
+}
+
+void bench_queues(day12::Bench &bench, const SuiteConfig &cfg) {
+    // 阻塞唤醒一次往返就是几微秒，轮数比其它负载少一个数量级
+    auto rounds = std::max<std::uint64_t>(1000, cfg.ops / 10);
+    for (unsigned threads : cfg.thread_counts()) {
+        if (threads < 2) continue; // 至少一对
+        unsigned pairs = threads / 2;
+        ping_pong<day8::MPMCQueue<std::uint64_t>>(
+            bench, with_threads("pingpong/mpmc", pairs * 2), pairs, rounds);
+        ping_pong<day8::BlockingQueue<std::uint64_t>>(
+            bench, with_threads("pingpong/blocking", pairs * 2), pairs, rounds);
+    }
+}
+
+// ---- Scheduler ----
+
+template <class Sched>
+void timer_churn(day12::Bench &bench, const SuiteConfig &cfg, const std::string &kind, Sched &sched) {
+    auto noop = []{};
+    for (unsigned threads : cfg.thread_counts()) {
+        // 设一个超时又马上取消：取消留下墓碑，由调度线程成批清理
+        bench.run_concurrent(with_threads("sched/" + kind + "/post_cancel", threads), threads, cfg.ops,
+                             [&](unsigned, std::uint64_t) {
+                                 auto h = sched.post_after(std::chrono::milliseconds(50), noop);
+                                 h.cancel();
+                             });
+
+        // 连接空闲超时：每个线程一个定时器，每次活动都续期
+        std::vector<day14::TimerHandle> handles(threads);
+        for (auto &h : handles) h = sched.post_after(std::chrono::seconds(10), noop);
+        bench.run_concurrent(with_threads("sched/" + kind + "/reschedule", threads), threads, cfg.ops,
+                             [&](unsigned t, std::uint64_t) {
+                                 handles[t].reschedule(std::chrono::seconds(10));
+                             });
+        for (auto &h : handles) h.cancel();
+    }
+}
+
+void bench_scheduler(day12::Bench &bench, const SuiteConfig &cfg) {
+    day14::ThreadPool pool(2, 4096);
+    {
+        day14::Scheduler sched(pool);
+        timer_churn(bench, cfg, "heap", sched);
+    }
+    {
+        day14::WheelScheduler sched(pool, std::chrono::milliseconds(1));
+        timer_churn(bench, cfg, "wheel", sched);
+    }
+    {
+        day14::ShardedWheelScheduler sched(pool, 0, std::chrono::milliseconds(1));
+        timer_churn(bench, cfg, "sharded_wheel", sched);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    auto cfg = SuiteConfig::from_args(argc, argv);
+    day12::Bench bench(day12::BenchOptions::from_args(argc, argv));
+    std::cout << "max threads=" << cfg.max_threads << ", ops/thread=" << cfg.ops
+              << ", hardware_concurrency=" << std::thread::hardware_concurrency() << "\n";
+
+    bench_lru(bench, cfg);
+    bench_pool(bench, cfg);
+    bench_queues(bench, cfg);
+    bench_scheduler(bench, cfg);
+    return bench.finish();
+}
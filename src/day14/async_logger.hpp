@@ -0,0 +1,568 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "../day8/spsc_queue.hpp"
+
+// AsyncLogger：worker 线程里替代 std::cout 的异步日志
+// 典型用法：
+//   day14::AsyncLogger log;                                   // 默认写 stdout
+//   day14::AsyncLogger flog("app.log", {4096, day14::FullPolicy::kBlock});
+//   pool.submit([&]{ log.info("task {} done in {} us", id, us); });
+//   log.flush();                                              // 需要时同步等落盘
+//
+// 设计要点：
+// - 每个线程对每个 logger 有自己的 day8::SPSCQueue，写日志只是把参数拷进一条定长记录再入队：
+//   不加锁、不格式化、不做系统调用
+// - 格式化推迟到后台线程：记录里存格式串指针 + 参数副本 + 按参数类型生成的格式化函数；
+//   字符串参数（char* / string_view）拷成 std::string，格式串本身必须是静态字符串
+// - 唯一的后台线程每 interval 倒空所有队列，按时间戳排好序、格式化进 64 KiB 的块，
+//   再用一次（至多 IOV_MAX 块一次）writev 写出去
+// - 队列满时按 FullPolicy：kDrop 丢弃并计数（默认，热路径永不等待）；
+//   kBlock 唤醒后台线程并等它倒空一轮再重试
+// - 占位符是 {}，{{ 和 }} 输出字面的花括号；参数多于占位符时依次追加在行尾
+// - 线程退出后它的队列仍由 logger 持有，倒空后才释放
+// - log 返回 true 的记录一定会被写出或计入 write_errors：stop 先等所有已越过运行检查的
+//   生产者入队完成，再做最后一轮倒空，写出数 + 丢弃数覆盖每一次 log 调用
+
+namespace day14 {
+
+enum class LogLevel : std::uint8_t { kDebug, kInfo, kWarn, kError };
+
+inline const char *to_string(LogLevel level) noexcept {
+    switch (level) {
+    case LogLevel::kDebug: return "DEBUG";
+    case LogLevel::kInfo:  return "INFO ";
+    case LogLevel::kWarn:  return "WARN ";
+    case LogLevel::kError: return "ERROR";
+    }
+    return "?    ";
+}
+
+enum class FullPolicy { kDrop, kBlock };
+
+struct LoggerOptions {
+    std::size_t queue_capacity = 1024;     // 每线程记录数，向上取 2 的幂
+    FullPolicy policy = FullPolicy::kDrop;
+    std::chrono::milliseconds interval{5}; // 后台线程最长多久倒空一次
+    LogLevel level = LogLevel::kDebug;     // 低于该级别的直接丢弃，不入队
+};
+
+namespace log_detail {
+
+// 参数在记录里的存储类型：字符串一律拷成 std::string，其余按值保存
+template <class T>
+using stored_t = std::conditional_t<
+    std::is_convertible_v<const std::decay_t<T>&, std::string_view> &&
+        !std::is_same_v<std::decay_t<T>, std::nullptr_t>,
+    std::string, std::decay_t<T>>;
+
+// 把实参转换成存储类型；空的 char* 记为 (null)
+template <class T>
+stored_t<T> store(T &&v) {
+    if constexpr (std::is_pointer_v<std::remove_reference_t<T>> && std::is_same_v<stored_t<T>, std::string>) {
+        return v ? std::string(v) : std::string("(null)");
+    } else {
+        return stored_t<T>(std::forward<T>(v));
+    }
+}
+
+inline void append(std::string &out, const std::string &s) { out += s; }
+
+template <class T>
+void append(std::string &out, const T &v) {
+    if constexpr (std::is_same_v<T, bool>) {
+        out += v ? "true" : "false";
+    } else if constexpr (std::is_same_v<T, char>) {
+        out += v;
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        char buf[64];
+        auto r = std::to_chars(buf, buf + sizeof(buf), v);
+        out.append(buf, r.ptr);
+    } else if constexpr (std::is_pointer_v<T>) {
+        char buf[2 + 16];
+        buf[0] = '0';
+        buf[1] = 'x';
+        auto r = std::to_chars(buf + 2, buf + sizeof(buf), reinterpret_cast<std::uintptr_t>(v), 16);
+        out.append(buf, r.ptr);
+    } else {
+        // 其它类型走 operator<<，反正是在后台线程里
+        std::ostringstream os;
+        os << v;
+        out += os.str();
+    }
+}
+
+// 把 p 开始的字面文本抄到 out，直到遇到占位符 {}（跳过它并返回 true）或字符串结尾（返回 false）
+inline bool copy_literal(std::string &out, const char *&p) {
+    for (;;) {
+        const char *q = p;
+        while (*q && *q != '{' && *q != '}') ++q;
+        out.append(p, q);
+        p = q;
+        if (*p == '\0') return false;
+        if (p[0] == '{' && p[1] == '}') { p += 2; return true; }
+        if ((p[0] == '{' && p[1] == '{') || (p[0] == '}' && p[1] == '}')) {
+            out += *p;
+            p += 2;
+        } else {
+            out += *p++;
+        }
+    }
+}
+
+template <class Tuple>
+void format(const char *fmt, const Tuple &args, std::string &out) {
+    const char *p = fmt;
+    std::apply([&](const auto &...a) {
+        ((copy_literal(out, p) ? void() : void(out += ' '), append(out, a)), ...);
+    }, args);
+    while (copy_literal(out, p)) out += "{}"; // 多出来的占位符原样输出
+}
+
+} // namespace log_detail
+
+// 一条日志：格式串、参数副本和处理这些参数的函数表
+class LogRecord {
+public:
+    static constexpr std::size_t kInlineArgs = 80; // 参数元组放不下时才单独分配
+
+    template <class... Args>
+    LogRecord(LogLevel level, std::uint32_t tid, const char *fmt, Args&&... args)
+        : ts_ns(wall_ns()), tid(tid), level(level), fmt_(fmt) {
+        using Tuple = std::tuple<log_detail::stored_t<Args>...>;
+        static_assert(std::is_nothrow_move_constructible_v<Tuple>,
+                      "日志参数的移动构造必须是 noexcept");
+        if constexpr (fits_inline<Tuple>()) {
+            ::new (static_cast<void *>(args_)) Tuple(log_detail::store(std::forward<Args>(args))...);
+            ops_ = &kInlineOps<Tuple>;
+        } else {
+            auto *heap = new Tuple(log_detail::store(std::forward<Args>(args))...);
+            std::memcpy(args_, &heap, sizeof(heap));
+            ops_ = &kHeapOps<Tuple>;
+        }
+    }
+
+    LogRecord(LogRecord &&o) noexcept
+        : ts_ns(o.ts_ns), tid(o.tid), level(o.level), ops_(o.ops_), fmt_(o.fmt_) {
+        if (ops_) ops_->relocate(args_, o.args_);
+        o.ops_ = nullptr;
+    }
+
+    LogRecord &operator=(LogRecord &&o) noexcept {
+        if (this != &o) {
+            reset();
+            ts_ns = o.ts_ns;
+            tid = o.tid;
+            level = o.level;
+            fmt_ = o.fmt_;
+            ops_ = o.ops_;
+            if (ops_) ops_->relocate(args_, o.args_);
+            o.ops_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~LogRecord() { reset(); }
+
+    LogRecord(const LogRecord&) = delete;
+    LogRecord &operator=(const LogRecord&) = delete;
+
+    void format_message(std::string &out) const {
+        if (ops_) ops_->format(fmt_, args_, out);
+    }
+
+    static std::uint64_t wall_ns() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    std::uint64_t ts_ns;
+    std::uint32_t tid;
+    LogLevel level;
+
+private:
+    struct Ops {
+        void (*format)(const char *fmt, const unsigned char *args, std::string &out);
+        void (*relocate)(unsigned char *dst, unsigned char *src) noexcept; // 移动到 dst 并销毁 src
+        void (*destroy)(unsigned char *args) noexcept;
+    };
+
+    template <class Tuple>
+    static constexpr bool fits_inline() {
+        return sizeof(Tuple) <= kInlineArgs && alignof(Tuple) <= alignof(std::max_align_t);
+    }
+
+    template <class Tuple>
+    static Tuple *inline_ptr(unsigned char *p) noexcept {
+        return std::launder(reinterpret_cast<Tuple *>(p));
+    }
+
+    template <class Tuple>
+    static const Tuple *inline_ptr(const unsigned char *p) noexcept {
+        return std::launder(reinterpret_cast<const Tuple *>(p));
+    }
+
+    template <class Tuple>
+    static Tuple *heap_ptr(const unsigned char *p) noexcept {
+        Tuple *t;
+        std::memcpy(&t, p, sizeof(t));
+        return t;
+    }
+
+    template <class Tuple>
+    static constexpr Ops kInlineOps{
+        [](const char *fmt, const unsigned char *args, std::string &out) {
+            log_detail::format(fmt, *inline_ptr<Tuple>(args), out);
+        },
+        [](unsigned char *dst, unsigned char *src) noexcept {
+            auto *s = inline_ptr<Tuple>(src);
+            ::new (static_cast<void *>(dst)) Tuple(std::move(*s));
+            s->~Tuple();
+        },
+        [](unsigned char *args) noexcept { inline_ptr<Tuple>(args)->~Tuple(); },
+    };
+
+    template <class Tuple>
+    static constexpr Ops kHeapOps{
+        [](const char *fmt, const unsigned char *args, std::string &out) {
+            log_detail::format(fmt, *heap_ptr<Tuple>(args), out);
+        },
+        [](unsigned char *dst, unsigned char *src) noexcept {
+            std::memcpy(dst, src, sizeof(Tuple *));
+        },
+        [](unsigned char *args) noexcept { delete heap_ptr<Tuple>(args); },
+    };
+
+    void reset() noexcept {
+        if (ops_) ops_->destroy(args_);
+        ops_ = nullptr;
+    }
+
+    const Ops *ops_ = nullptr;
+    const char *fmt_;
+    alignas(std::max_align_t) unsigned char args_[kInlineArgs];
+};
+
+class AsyncLogger {
+public:
+    // 写到已打开的 fd（不负责关闭）
+    explicit AsyncLogger(int fd = STDOUT_FILENO, LoggerOptions opts = {})
+        : fd_(fd), owns_fd_(false), opts_(opts), level_(opts.level) {
+        start();
+    }
+
+    // 以追加方式打开 path，打不开抛 std::system_error
+    explicit AsyncLogger(const std::string &path, LoggerOptions opts = {})
+        : fd_(::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644)),
+          owns_fd_(true), opts_(opts), level_(opts.level) {
+        if (fd_ < 0) throw std::system_error(errno, std::generic_category(), "AsyncLogger: open " + path);
+        start();
+    }
+
+    ~AsyncLogger() {
+        stop();
+        std::lock_guard<std::mutex> lock(registry_mtx_);
+        for (auto &q : queues_) q->closed.store(true, std::memory_order_release);
+        if (owns_fd_) ::close(fd_);
+    }
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // 返回 false 表示被级别过滤、队列满被丢弃或 logger 已停止
+    template <class... Args>
+    bool log(LogLevel level, const char *fmt, Args&&... args) {
+        if (!enabled(level)) return false;
+        auto &q = local_queue();
+        // busy 与 running_ 都用 seq_cst：要么这里看到 running_ 为 false，要么 stop 看到 busy，等本次入队完成
+        q.busy.store(true, std::memory_order_seq_cst);
+        BusyGuard guard{q.busy};
+        if (!running_.load(std::memory_order_seq_cst)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        LogRecord rec(level, q.tid, fmt, std::forward<Args>(args)...);
+        while (!q.ring.try_push(std::move(rec))) {
+            if (opts_.policy == FullPolicy::kDrop || !wait_for_drain()) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class... Args> bool debug(const char *fmt, Args&&... args) { return log(LogLevel::kDebug, fmt, std::forward<Args>(args)...); }
+    template <class... Args> bool info(const char *fmt, Args&&... args)  { return log(LogLevel::kInfo,  fmt, std::forward<Args>(args)...); }
+    template <class... Args> bool warn(const char *fmt, Args&&... args)  { return log(LogLevel::kWarn,  fmt, std::forward<Args>(args)...); }
+    template <class... Args> bool error(const char *fmt, Args&&... args) { return log(LogLevel::kError, fmt, std::forward<Args>(args)...); }
+
+    bool enabled(LogLevel level) const noexcept {
+        return level >= level_.load(std::memory_order_relaxed);
+    }
+
+    void set_level(LogLevel level) noexcept { level_.store(level, std::memory_order_relaxed); }
+
+    // 等后台线程把调用之前入队的记录全部写出
+    void flush() { wait_for_drain(); }
+
+    // 写完剩余记录后停止后台线程；之后的 log 一律丢弃并计数
+    void stop() {
+        running_.store(false, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (stop_) return;
+        }
+        // 等已经越过 running_ 检查的生产者入队完成；此时后台线程还在跑，kBlock 的生产者也能等到倒空。
+        // 之后才注册的队列在 registry_mtx_ 之后读 running_，必然看到 false
+        for (auto &q : snapshot_queues()) {
+            while (q->busy.load(std::memory_order_seq_cst)) std::this_thread::yield();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (stop_) return;
+            stop_ = true;
+        }
+        cv_.notify_one();
+        if (flusher_.joinable()) flusher_.join();
+        // 后台线程已退出，在本线程再倒空一次，兜住最后一轮之后才入队的记录
+        std::vector<LogRecord> batch;
+        std::vector<std::string> chunks;
+        drain(batch);
+        write(batch, chunks);
+    }
+
+    std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+    std::uint64_t written() const noexcept { return written_.load(std::memory_order_relaxed); }
+    std::uint64_t write_errors() const noexcept { return write_errors_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t kChunkBytes = 64 * 1024;
+
+    struct ThreadQueue {
+        ThreadQueue(std::size_t cap, std::uint32_t tid) : ring(cap), tid(tid) {}
+        day8::SPSCQueue<LogRecord> ring;
+        const std::uint32_t tid;
+        std::atomic<bool> retired{false}; // 所属线程已退出
+        std::atomic<bool> closed{false};  // 所属 logger 已析构
+        std::atomic<bool> busy{false};    // 所属线程正在 log() 里，stop 要等它入队完成
+    };
+
+    struct BusyGuard {
+        std::atomic<bool> &flag;
+        ~BusyGuard() { flag.store(false, std::memory_order_seq_cst); }
+    };
+
+    std::vector<std::shared_ptr<ThreadQueue>> snapshot_queues() {
+        std::lock_guard<std::mutex> lock(registry_mtx_);
+        return queues_;
+    }
+
+    // 线程本地的 (logger, 队列) 表；线程退出时把自己的队列标成 retired
+    struct LocalEntry {
+        std::uint64_t logger_id;
+        std::shared_ptr<ThreadQueue> queue;
+
+        LocalEntry(std::uint64_t id, std::shared_ptr<ThreadQueue> q) : logger_id(id), queue(std::move(q)) {}
+        LocalEntry(LocalEntry&&) noexcept = default;
+        LocalEntry &operator=(LocalEntry&&) noexcept = default;
+        ~LocalEntry() {
+            if (queue) queue->retired.store(true, std::memory_order_release);
+        }
+    };
+
+    static std::uint64_t next_id() noexcept {
+        static std::atomic<std::uint64_t> id{0};
+        return id.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    void start() { flusher_ = std::thread(&AsyncLogger::flush_loop, this); }
+
+    ThreadQueue &local_queue() {
+        thread_local std::vector<LocalEntry> entries;
+        for (auto &e : entries) {
+            if (e.logger_id == id_) return *e.queue;
+        }
+        // 顺便清掉已析构 logger 留下的表项
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [](const LocalEntry &e) {
+            return e.queue->closed.load(std::memory_order_acquire);
+        }), entries.end());
+        auto q = std::make_shared<ThreadQueue>(opts_.queue_capacity,
+                                               static_cast<std::uint32_t>(::syscall(SYS_gettid)));
+        {
+            std::lock_guard<std::mutex> lock(registry_mtx_);
+            queues_.push_back(q);
+        }
+        entries.emplace_back(id_, q);
+        return *q;
+    }
+
+    // 请求后台线程倒空一轮并等它完成；logger 已停止时返回 false
+    bool wait_for_drain() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (stop_) return false;
+        auto target = ++drain_requested_;
+        cv_.notify_one();
+        done_cv_.wait(lock, [&]{ return drain_done_ >= target || stop_; });
+        return drain_done_ >= target;
+    }
+
+    void flush_loop() {
+        std::vector<LogRecord> batch;
+        std::vector<std::string> chunks;
+        std::unique_lock<std::mutex> lock(mtx_);
+        for (;;) {
+            cv_.wait_for(lock, opts_.interval, [this]{ return stop_ || drain_requested_ != drain_done_; });
+            bool stopping = stop_;
+            auto target = drain_requested_;
+            lock.unlock();
+
+            drain(batch);
+            write(batch, chunks);
+            batch.clear();
+
+            lock.lock();
+            drain_done_ = target;
+            done_cv_.notify_all();
+            if (stopping) return;
+        }
+    }
+
+    void drain(std::vector<LogRecord> &batch) {
+        for (auto &q : snapshot_queues()) {
+            // 先读 retired 再倒空：读到 true 时线程已不会再写，倒完就可以释放
+            bool retired = q->retired.load(std::memory_order_acquire);
+            while (q->ring.pop_n(std::back_inserter(batch), q->ring.capacity()) != 0) {}
+            if (retired) {
+                std::lock_guard<std::mutex> lock(registry_mtx_);
+                queues_.erase(std::find(queues_.begin(), queues_.end(), q));
+            }
+        }
+        // 各线程队列内部有序，合并后按时间戳排一次
+        std::stable_sort(batch.begin(), batch.end(), [](const LogRecord &a, const LogRecord &b) {
+            return a.ts_ns < b.ts_ns;
+        });
+    }
+
+    // 行格式：2026-01-02 15:04:05.123456 INFO  [tid] message
+    void append_prefix(std::string &out, const LogRecord &r) {
+        auto sec = static_cast<std::time_t>(r.ts_ns / 1000000000u);
+        if (sec != cached_sec_) {
+            std::tm tm{};
+            localtime_r(&sec, &tm);
+            std::strftime(cached_time_, sizeof(cached_time_), "%Y-%m-%d %H:%M:%S", &tm);
+            cached_sec_ = sec;
+        }
+        char buf[64];
+        int n = std::snprintf(buf, sizeof(buf), "%s.%06u %s [%u] ", cached_time_,
+                              static_cast<unsigned>(r.ts_ns / 1000u % 1000000u),
+                              to_string(r.level), static_cast<unsigned>(r.tid));
+        out.append(buf, static_cast<std::size_t>(n));
+    }
+
+    void write(const std::vector<LogRecord> &batch, std::vector<std::string> &chunks) {
+        if (batch.empty()) return;
+        std::size_t used = 0;
+        auto next_chunk = [&]() -> std::string & {
+            if (used == chunks.size()) chunks.emplace_back();
+            auto &c = chunks[used++];
+            c.clear();
+            c.reserve(kChunkBytes);
+            return c;
+        };
+        std::string *cur = &next_chunk();
+        for (const auto &r : batch) {
+            if (cur->size() >= kChunkBytes) cur = &next_chunk();
+            append_prefix(*cur, r);
+            r.format_message(*cur);
+            *cur += '\n';
+        }
+
+        std::vector<iovec> iov(used);
+        for (std::size_t i = 0; i < used; ++i) {
+            iov[i].iov_base = chunks[i].data();
+            iov[i].iov_len = chunks[i].size();
+        }
+        write_all(iov);
+        written_.fetch_add(batch.size(), std::memory_order_relaxed);
+        if (chunks.size() > 4) chunks.resize(4); // 偶发的大批次不要一直占着内存
+    }
+
+    // writev 可能只写一部分，推进 iovec 继续写；出错则放弃本批并计数
+    void write_all(std::vector<iovec> &iov) {
+        std::size_t first = 0;
+        while (first < iov.size()) {
+            int cnt = static_cast<int>(std::min<std::size_t>(iov.size() - first, IOV_MAX));
+            ssize_t n = ::writev(fd_, iov.data() + first, cnt);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                write_errors_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            auto left = static_cast<std::size_t>(n);
+            while (first < iov.size() && left >= iov[first].iov_len) left -= iov[first++].iov_len;
+            if (left) {
+                iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + left;
+                iov[first].iov_len -= left;
+            }
+        }
+    }
+
+    const int fd_;
+    const bool owns_fd_;
+    const LoggerOptions opts_;
+    const std::uint64_t id_ = next_id();
+    std::atomic<LogLevel> level_;
+    std::atomic<bool> running_{true};
+
+    std::mutex registry_mtx_;
+    std::vector<std::shared_ptr<ThreadQueue>> queues_;
+
+    std::mutex mtx_;                  // 保护以下三项
+    std::condition_variable cv_;      // 唤醒后台线程
+    std::condition_variable done_cv_; // 后台线程完成一轮
+    bool stop_ = false;
+    std::uint64_t drain_requested_ = 0;
+    std::uint64_t drain_done_ = 0;
+
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> written_{0};
+    std::atomic<std::uint64_t> write_errors_{0};
+
+    // 只由后台线程访问
+    std::time_t cached_sec_ = -1;
+    char cached_time_[32] = {};
+
+    std::thread flusher_;             // 最后构造
+};
+
+} // namespace day14
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "async_logger.hpp"
+#include "thread_pool.hpp"
+
+using day14::AsyncLogger;
+using day14::ThreadPool;
+using Clock = std::chrono::steady_clock;
+
+// 线程池任务里打日志：training 里 ostringstream + std::cout 的写法 vs AsyncLogger
+// 两者都写到 /dev/null，只比较 worker 线程上的开销；最后演示 drop / block 两种满队列策略
+
+template <class F>
+static double run_tasks(int tasks, F log_line) {
+    ThreadPool pool(4, 1024);
+    std::vector<std::future<void>> fs;
+    fs.reserve(tasks);
+    auto t0 = Clock::now();
+    for (int i = 0; i < tasks; ++i) {
+        fs.push_back(pool.submit([i, &log_line]{ log_line(i); }));
+    }
+    for (auto &f : fs) f.get();
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+int main() {
+    const int tasks = 200000;
+
+    {
+        std::ofstream null("/dev/null");
+        auto *old = std::cout.rdbuf(null.rdbuf());
+        double ms = run_tasks(tasks, [](int i) {
+            std::ostringstream oss;
+            oss << "task " << i << " on thread " << std::this_thread::get_id()
+                << " result=" << i * 0.5 << "\n";
+            std::cout << oss.str();
+        });
+        std::cout.rdbuf(old);
+        std::cout << "ostringstream + std::cout: " << ms << " ms for " << tasks << " tasks\n";
+    }
+
+    {
+        AsyncLogger log("/dev/null", {4096, day14::FullPolicy::kBlock});
+        double ms = run_tasks(tasks, [&log](int i) {
+            log.info("task {} result={}", i, i * 0.5);
+        });
+        log.flush();
+        std::cout << "AsyncLogger (block):       " << ms << " ms, written=" << log.written()
+                  << " dropped=" << log.dropped() << "\n";
+    }
+
+    {
+        // 很小的队列 + 很长的刷新间隔：写日志的速度远超后台线程，drop 策略直接丢弃
+        AsyncLogger log("/dev/null", {64, day14::FullPolicy::kDrop, std::chrono::milliseconds(50)});
+        double ms = run_tasks(tasks, [&log](int i) {
+            log.info("task {} result={}", i, i * 0.5);
+        });
+        log.flush();
+        std::cout << "AsyncLogger (drop, cap 64): " << ms << " ms, written=" << log.written()
+                  << " dropped=" << log.dropped() << "\n";
+    }
+
+    std::cout << "\n样例输出：\n" << std::flush;
+    AsyncLogger log; // stdout
+    log.set_level(day14::LogLevel::kInfo);
+    ThreadPool pool(2, 16);
+    std::vector<std::future<void>> fs;
+    for (int i = 0; i < 4; ++i) {
+        fs.push_back(pool.submit([&log, i]{
+            std::string user = "user-" + std::to_string(i);
+            log.debug("filtered out {}", i);
+            log.info("{} logged in, session {{{}}}", user, i * 1000 + 7);
+            if (i == 3) log.warn("slow request: {} ms, ok={}", 12.5, false);
+        }));
+    }
+    for (auto &f : fs) f.get();
+    log.error("extra args are appended:", 1, 'x', "tail");
+    log.flush();
+}
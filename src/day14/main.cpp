@@ -0,0 +1,85 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+using day14::ThreadPool;
+
+#if DAY14_POOL_METRICS
+static void print_hist(const char *name, const day14::HistogramSnapshot &h) {
+    std::cout << name << ": count=" << h.count
+              << " mean=" << h.mean_ns() / 1000.0 << "us"
+              << " p50<=" << h.percentile_ns(0.50) / 1000.0 << "us"
+              << " p99<=" << h.percentile_ns(0.99) / 1000.0 << "us"
+              << " max=" << h.max_ns / 1000.0 << "us\n";
+}
+
+static void print_metrics(const ThreadPool &pool) {
+    auto m = pool.metrics();
+    print_hist("queue wait", m.queue_wait);
+    print_hist("run time  ", m.run_time);
+    for (size_t i = 0; i < m.workers.size(); ++i) {
+        const auto &w = m.workers[i];
+        std::cout << "worker " << i << ": tasks=" << w.tasks
+                  << " utilization=" << w.utilization() * 100.0 << "%\n";
+    }
+    std::cout << "queue high water=" << m.queue_high_water
+              << " submit blocked=" << m.submit_blocked
+              << " (" << m.submit_blocked_ns / 1000.0 << "us)\n";
+}
+#endif
+
+int main() {
+    std::cout << "== ThreadPool 指标 ==\n";
+    ThreadPool pool(3, 8);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 40; ++i) {
+        results.push_back(pool.submit([i]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            return i * i;
+        }));
+    }
+    long long sum = 0;
+    for (auto &f : results) sum += f.get();
+    std::cout << "sum of squares = " << sum << "\n";
+
+#if DAY14_POOL_METRICS
+    print_metrics(pool);
+#else
+    std::cout << "metrics compiled out (DAY14_POOL_METRICS=0)\n";
+#endif
+
+    std::cout << "\n== EDF：截止任务插到批量任务前面 ==\n";
+    ThreadPool single(1, 1024);
+    std::atomic<int> bulk_done{0};
+    for (int i = 0; i < 200; ++i) {
+        single.submit([&bulk_done]{
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+            ++bulk_done;
+        });
+    }
+    auto now = day14::PoolClock::now();
+    auto late = single.submit_by(now + std::chrono::milliseconds(50), [&bulk_done]{
+        return bulk_done.load();
+    });
+    auto urgent = single.submit_by(now + std::chrono::milliseconds(10), [&bulk_done]{
+        return bulk_done.load();
+    });
+    std::cout << "urgent ran after " << urgent.get() << " bulk tasks, "
+              << "later deadline after " << late.get() << "\n";
+    auto missed = single.submit_by(day14::PoolClock::now(), []{
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    missed.get();
+    single.shutdown();
+    auto d = single.deadline_stats();
+    std::cout << "deadline met=" << d.met << " missed=" << d.missed
+              << " max lateness=" << d.lateness.max_ns / 1000.0 << "us\n";
+
+    pool.shutdown();
+    return 0;
+}
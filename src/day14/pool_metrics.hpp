@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 线程池运行时指标（可编译期关闭）
+// 编译时加 -DDAY14_POOL_METRICS=0 即可把所有埋点编译掉，ThreadPool 退化为原始版本。
+//
+// 设计要点：
+// - 直方图按 log2(ns) 分桶，记录一次只需一次 relaxed fetch_add，不加锁
+// - 每个 worker 的忙/闲时间只由自己写，单独占一条 cache line，避免伪共享
+// - 快照（snapshot）只是把原子量读成普通整数，读到的是“近似一致”的视图
+
+#ifndef DAY14_POOL_METRICS
+#define DAY14_POOL_METRICS 1
+#endif
+
+namespace day14 {
+
+using MetricsClock = std::chrono::steady_clock;
+
+inline std::uint64_t elapsed_ns(MetricsClock::time_point from,
+                                MetricsClock::time_point to) noexcept {
+    auto d = std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+    return d > 0 ? static_cast<std::uint64_t>(d) : 0;
+}
+
+// 直方图快照：buckets[i] 统计落在 [2^i, 2^(i+1)) ns 的样本数（0 ns 记在 bucket 0）
+struct HistogramSnapshot {
+    static constexpr std::size_t kBuckets = 64;
+
+    std::array<std::uint64_t, kBuckets> buckets{};
+    std::uint64_t count = 0;
+    std::uint64_t sum_ns = 0;
+    std::uint64_t max_ns = 0;
+
+    double mean_ns() const noexcept {
+        return count ? static_cast<double>(sum_ns) / static_cast<double>(count) : 0.0;
+    }
+
+    // 近似分位数：返回目标样本所在桶的上界，p 取值 [0, 1]
+    std::uint64_t percentile_ns(double p) const noexcept {
+        if (count == 0) return 0;
+        auto target = static_cast<std::uint64_t>(p * static_cast<double>(count));
+        if (target >= count) target = count - 1;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBuckets; ++i) {
+            seen += buckets[i];
+            if (seen > target) {
+                std::uint64_t upper = (i + 1 < 64) ? (std::uint64_t{1} << (i + 1)) : max_ns;
+                return upper < max_ns ? upper : max_ns;
+            }
+        }
+        return max_ns;
+    }
+};
+
+// 无锁 log2 直方图：多线程并发 record，任意线程 snapshot
+class LatencyHistogram {
+public:
+    void record(std::uint64_t ns) noexcept {
+        buckets_[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(ns, std::memory_order_relaxed);
+        auto cur = max_.load(std::memory_order_relaxed);
+        while (ns > cur &&
+               !max_.compare_exchange_weak(cur, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    HistogramSnapshot snapshot() const noexcept {
+        HistogramSnapshot s;
+        for (std::size_t i = 0; i < HistogramSnapshot::kBuckets; ++i) {
+            s.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        }
+        s.count  = count_.load(std::memory_order_relaxed);
+        s.sum_ns = sum_.load(std::memory_order_relaxed);
+        s.max_ns = max_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    static std::size_t bucket_of(std::uint64_t ns) noexcept {
+        std::size_t b = 0;
+        while (ns > 1) {
+            ns >>= 1;
+            ++b;
+        }
+        return b;
+    }
+
+    std::array<std::atomic<std::uint64_t>, HistogramSnapshot::kBuckets> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+// 单个 worker 的统计，只由所属线程写入
+struct alignas(64) WorkerCounters {
+    std::atomic<std::uint64_t> busy_ns{0};
+    std::atomic<std::uint64_t> idle_ns{0};
+    std::atomic<std::uint64_t> tasks{0};
+};
+
+struct WorkerSnapshot {
+    std::uint64_t busy_ns = 0;
+    std::uint64_t idle_ns = 0;
+    std::uint64_t tasks = 0;
+
+    // 利用率 = 忙 / (忙 + 闲)
+    double utilization() const noexcept {
+        auto total = busy_ns + idle_ns;
+        return total ? static_cast<double>(busy_ns) / static_cast<double>(total) : 0.0;
+    }
+};
+
+// 截止时间统计（不受 DAY14_POOL_METRICS 控制，EDF 调度本身需要它）
+struct DeadlineSnapshot {
+    std::uint64_t met = 0;
+    std::uint64_t missed = 0;
+    HistogramSnapshot lateness;   // 错过时：完成时间 - 截止时间
+
+    double miss_ratio() const noexcept {
+        auto total = met + missed;
+        return total ? static_cast<double>(missed) / static_cast<double>(total) : 0.0;
+    }
+};
+
+struct PoolMetricsSnapshot {
+    HistogramSnapshot queue_wait;   // 入队 -> 开始执行
+    HistogramSnapshot run_time;     // 任务执行耗时
+    std::vector<WorkerSnapshot> workers;
+    std::size_t queue_high_water = 0;   // 队列深度最高水位
+    std::uint64_t submit_blocked = 0;      // submit 因队列满而等待的次数
+    std::uint64_t submit_blocked_ns = 0;   // submit 在 cv_not_full 上累计阻塞时间
+};
+
+} // namespace day14
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "${BASH_SOURCE[0]%/*}" && pwd)"
+BUILD_DIR="${SCRIPT_DIR}/../build/day14"
+SRC_DIR="${SCRIPT_DIR}"
+
+usage() {
+  cat <<'EOF'
+用法: ./run.sh [pool|sched|trace|log|all]
+  pool  编译运行线程池指标示例（排队延迟/执行耗时/忙闲比/队列水位）
+  sched 编译运行调度器示例（小顶堆 vs 分层时间轮）
+  trace 编译运行追踪示例，生成 build/day14/trace.json，可用 ui.perfetto.dev 打开
+  log   编译运行异步日志示例（对比 ostringstream + std::cout，drop / block 策略）
+  all   编译运行全部示例（默认）
+EOF
+}
+
+build() {
+  mkdir -p "${BUILD_DIR}"
+  local target="$1" src="$2"; shift 2
+  echo "[BUILD] ${src} -> ${target}"
+  g++ -std=c++17 -O0 -g -Wall -Wextra -pedantic -pthread "$@" \
+      "${SRC_DIR}/${src}" -o "${BUILD_DIR}/${target}"
+}
+
+run_pool() {
+  build "pool_metrics" "main.cpp"
+  echo "[RUN ] pool_metrics" && "${BUILD_DIR}/pool_metrics"
+}
+
+run_sched() {
+  build "scheduler_demo" "scheduler_demo.cpp" -O2
+  echo "[RUN ] scheduler_demo" && "${BUILD_DIR}/scheduler_demo"
+}
+
+run_trace() {
+  build "trace_demo" "trace_demo.cpp" -O2
+  echo "[RUN ] trace_demo" && "${BUILD_DIR}/trace_demo" "${BUILD_DIR}/trace.json"
+}
+
+run_log() {
+  build "logger_demo" "logger_demo.cpp" -O2
+  echo "[RUN ] logger_demo" && "${BUILD_DIR}/logger_demo"
+}
+
+choice=${1:-all}
+case "${choice}" in
+  pool) run_pool ;;
+  sched) run_sched ;;
+  trace) run_trace ;;
+  log)   run_log ;;
+  all)  run_pool; echo; run_sched; echo; run_trace; echo; run_log ;;
+  -h|--help) usage ;;
+  *) usage; exit 1 ;;
+esac
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "thread_pool.hpp"
+#include "timer_queue.hpp"
+#include "timer_wheel.hpp"
+
+// 调度器：支持立即任务、延迟一次任务、周期任务，到期后丢给 ThreadPool 执行
+// 典型用法：
+//   day14::ThreadPool pool(4, 64);
+//   day14::Scheduler sched(pool);                                    // 小顶堆后端
+//   day14::WheelScheduler wsched(pool, std::chrono::milliseconds(1)); // 时间轮后端
+//   auto h = sched.post_after(std::chrono::seconds(1), []{ ... });
+//   h.cancel(); // 超时还没到就不需要了
+//
+// 设计要点：
+// - 定时器存储是模板参数 TimerQueue（见 timer_queue.hpp 的接口约定），API 与后端无关
+// - 大量挂起超时（~1M）时用时间轮：插入 O(1)，每 tick 到期 O(1)，不再有堆的 O(log n) 上滤/下滤
+// - 一次醒来批量取出所有到期项，解锁后再派发到线程池
+// - post_after/post_every 返回 TimerHandle；取消是惰性墓碑，墓碑超过一半时成批清理。
+//   墓碑数只统计仍在队列里的旧条目，到期被顺带取走的会减掉，不会越积越多引发无谓的清理；
+//   shutdown 后句柄仍可安全使用（见 timer_handle.hpp 的 TimerOwnerLink）
+// - 周期任务固定频率、对齐首次触发时间；到期时在同一临界区里由后端就地重排，不拷贝条目
+// - 到期任务用 try_submit_bulk 成批交给线程池，线程池满时留在本地积压队列稍后重试，
+//   调度线程从不因背压阻塞；多核扩展见 sharded_scheduler.hpp
+// - shutdown 时积压队列里已到期的任务会阻塞地交给线程池再退出（线程池应比调度器晚关闭），
+//   未到期的定时器直接丢弃；线程池已关闭而交不出去的计入 dropped()
+// - 回调抛出的异常在线程池里被接住并计入 failed()，不会终止进程
+// - *_deadline 版本给任务附带截止时间（计划触发时间 + budget），派发时进入线程池的 EDF 队列，
+//   超时处理这类任务会插到先前排队的普通批量任务前面
+// - 取到期项和派发各有一个追踪 span（sched.collect / sched.dispatch），见 trace.hpp
+
+namespace day14 {
+
+template <class TimerQueue>
+class BasicScheduler : private TimerOwner {
+public:
+    using Clock = TimerClock;
+
+    // 额外参数原样转发给后端构造（例如时间轮的 tick 精度）
+    template <class... QueueArgs>
+    explicit BasicScheduler(ThreadPool &pool, QueueArgs&&... args)
+        : pool(pool), items(std::forward<QueueArgs>(args)...),
+          stop(false), link(std::make_shared<TimerOwnerLink>(static_cast<TimerOwner *>(this))),
+          scheduler_thread(&BasicScheduler::run, this) {}
+
+    ~BasicScheduler() { shutdown(); }
+
+    BasicScheduler(const BasicScheduler&) = delete;
+    BasicScheduler& operator=(const BasicScheduler&) = delete;
+
+    void shutdown() {
+        link->detach(); // 之后句柄的 reschedule 不再进入本调度器
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (stop) return;
+            stop = true;
+        }
+        cv.notify_all();
+        if (scheduler_thread.joinable()) scheduler_thread.join();
+    }
+
+    // 立即执行（丢给线程池）
+    template<typename F, typename... Args>
+    void post(F&& f, Args&&... args) {
+        auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        add_task(Clock::now(), std::move(bound), Clock::duration::zero(), MissedTick::kSkip);
+    }
+
+    // 延迟一次
+    template<typename Rep, typename Period, typename F, typename... Args>
+    TimerHandle post_after(const std::chrono::duration<Rep, Period> &delay,
+                    F&& f, Args&&... args) {
+        auto when = Clock::now() + delay;
+        auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        return TimerHandle(add_task(when, std::move(bound), Clock::duration::zero(),
+                                    MissedTick::kSkip));
+    }
+
+    // 周期任务（错过的 tick 默认跳过）
+    template<typename Rep, typename Period, typename F, typename... Args>
+    TimerHandle post_every(const std::chrono::duration<Rep, Period> &interval,
+                    F&& f, Args&&... args) {
+        return post_every(interval, MissedTick::kSkip,
+                          std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // 周期任务，指定错过 tick 的策略
+    template<typename Rep, typename Period, typename F, typename... Args>
+    TimerHandle post_every(const std::chrono::duration<Rep, Period> &interval,
+                           MissedTick policy, F&& f, Args&&... args) {
+        auto iv = std::chrono::duration_cast<Clock::duration>(interval);
+        if (iv <= Clock::duration::zero()) {
+            throw std::invalid_argument("post_every: interval must be positive");
+        }
+        auto when = Clock::now() + iv;
+        auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        return TimerHandle(add_task(when, std::move(bound), iv, policy));
+    }
+
+    // 延迟一次，并要求在触发后 budget 内执行完
+    template<typename Rep, typename Period, typename BRep, typename BPeriod,
+             typename F, typename... Args>
+    TimerHandle post_after_deadline(const std::chrono::duration<Rep, Period> &delay,
+                                    const std::chrono::duration<BRep, BPeriod> &budget,
+                                    F&& f, Args&&... args) {
+        auto when = Clock::now() + delay;
+        auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        return TimerHandle(add_task(when, std::move(bound), Clock::duration::zero(),
+                                    MissedTick::kSkip,
+                                    std::chrono::duration_cast<Clock::duration>(budget)));
+    }
+
+    // 周期任务，每一拍都要求在该拍计划时间后 budget 内执行完
+    template<typename Rep, typename Period, typename BRep, typename BPeriod,
+             typename F, typename... Args>
+    TimerHandle post_every_deadline(const std::chrono::duration<Rep, Period> &interval,
+                                    const std::chrono::duration<BRep, BPeriod> &budget,
+                                    F&& f, Args&&... args) {
+        auto iv = std::chrono::duration_cast<Clock::duration>(interval);
+        if (iv <= Clock::duration::zero()) {
+            throw std::invalid_argument("post_every_deadline: interval must be positive");
+        }
+        auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        return TimerHandle(add_task(Clock::now() + iv, std::move(bound), iv, MissedTick::kSkip,
+                                    std::chrono::duration_cast<Clock::duration>(budget)));
+    }
+
+    std::size_t pending() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return items.size();
+    }
+
+    // shutdown 时已到期、但线程池已关闭而无法交出的任务数
+    std::uint64_t dropped() const noexcept {
+        return shutdown_dropped.load(std::memory_order_relaxed);
+    }
+
+    // 回调抛出异常的次数（异常被吞掉，不影响线程池和其它定时器）
+    std::uint64_t failed() const noexcept {
+        return link->failures.load(std::memory_order_relaxed);
+    }
+
+private:
+    // 墓碑少于该数量时不值得做一次 O(n) 清理
+    static constexpr std::size_t kPurgeMin = 1024;
+    // 线程池满时，积压任务的重试间隔
+    static constexpr std::chrono::microseconds kBackoff{200};
+
+    std::shared_ptr<TimerTask> add_task(Clock::time_point when,
+                                        std::function<void()> func,
+                                        Clock::duration interval,
+                                        MissedTick policy,
+                                        Clock::duration budget = Clock::duration::max()) {
+        auto task = std::make_shared<TimerTask>(std::move(func), interval, policy, link);
+        task->budget = budget;
+        std::lock_guard<std::mutex> lock(mtx);
+        items.push(TimerItem{when, task, 0, seq++});
+        dirty = true;
+        cv.notify_one();
+        return task;
+    }
+
+    bool rearm(const std::shared_ptr<TimerTask> &task, Clock::time_point when) override {
+        std::lock_guard<std::mutex> lock(mtx);
+        // 已经离开队列（一次性定时器已派发、取消后已被取走）：不管线程池是否还持有它，一律拒绝
+        if (!task->queued.load(std::memory_order_relaxed)) return false;
+        auto gen = task->gen.fetch_add(1, std::memory_order_acq_rel) + 1;
+        // 旧条目还在队列里，因 gen 不符变成墓碑；若之前被取消过，cancel 已经记过这笔，这里重新激活
+        if (task->cancelled.exchange(false, std::memory_order_acq_rel) == false) {
+            link->note_cancel();
+        }
+        items.push(TimerItem{when, task, gen, seq++});
+        dirty = true;
+        cv.notify_one();
+        return true;
+    }
+
+    // 持锁调用：task 当前的条目离开了队列，之后 cancel/reschedule 都不再生效
+    static void leave_queue(const TimerItem &item) noexcept {
+        if (item.current()) item.task->queued.store(false, std::memory_order_release);
+    }
+
+    void purge_if_needed() {
+        auto n = link->tombstones.load(std::memory_order_relaxed);
+        if (n < kPurgeMin || n * 2 < items.size()) return;
+        link->tombstones.store(0, std::memory_order_relaxed);
+        items.remove_if([](const TimerItem &item){
+            if (!item.stale()) return false;
+            leave_queue(item);
+            return true;
+        });
+    }
+
+    // 线程池里真正执行的包装：派发后、执行前被取消也要跳过。
+    // 派发走 try_submit_bulk，没有 packaged_task 兜底，回调的异常必须在这里接住，
+    // 否则会逃出 worker_loop 直接 terminate；只计数，与原先丢弃 future 的效果一致
+    static void invoke(const std::shared_ptr<TimerTask> &task) {
+        if (task->cancelled.load(std::memory_order_acquire)) return;
+        try {
+            task->func();
+        } catch (...) {
+            task->owner->note_failure();
+        }
+    }
+
+    void run() {
+#if DAY14_TRACE
+        Tracer::name_this_thread("scheduler");
+#endif
+        std::vector<TimerItem> due;
+        std::deque<PoolTask> backlog; // 已到期但线程池暂时放不下，只由本线程访问
+        auto woken = [this]{ return stop || dirty; };
+        std::unique_lock<std::mutex> lock(mtx);
+        while (!stop) {
+            dirty = false;
+            purge_if_needed();
+            auto now = Clock::now();
+            if (items.empty() || items.next_wakeup() > now) {
+                if (backlog.empty()) {
+                    // 新任务可能比当前最早的还早，所以 add_task 置 dirty 也要唤醒重算
+                    if (items.empty()) cv.wait(lock, woken);
+                    else cv.wait_until(lock, items.next_wakeup(), woken);
+                    continue;
+                }
+            } else {
+                // 取出全部到期任务；周期任务按计划时间（而不是派发完成时间）推进到下一拍
+                DAY14_TRACE_SPAN("sched.collect");
+                items.pop_expired(now, due, [this, now](TimerItem &item) {
+                    if (item.stale()) {
+                        link->note_reclaimed(); // 墓碑到期顺带取走，不用再等 purge
+                        leave_queue(item);
+                        return false;
+                    }
+                    if (item.task->interval == Clock::duration::zero()) {
+                        leave_queue(item);
+                        return false;
+                    }
+                    item.when = item.task->next_fire(item.when, now);
+                    return true;
+                });
+            }
+            lock.unlock();
+
+            {
+                DAY14_TRACE_SPAN("sched.dispatch");
+                for (auto &item : due) {
+                    if (item.stale()) continue; // 墓碑：已取消或已被 reschedule
+                    // 周期任务共享同一个 TimerTask，不再拷贝 func；截止时间从这一拍的计划时间算起
+                    auto deadline = item.task->has_deadline() ? item.when + item.task->budget
+                                                              : PoolTask::kNoDeadline;
+                    backlog.push_back(PoolTask{[task = std::move(item.task)]{ invoke(task); },
+                                               deadline});
+                }
+                due.clear();
+                // 成批丢给线程池，一次加锁；放不下的留到下一轮
+                auto n = pool.try_submit_bulk(backlog.begin(), backlog.end());
+                backlog.erase(backlog.begin(), backlog.begin() + static_cast<std::ptrdiff_t>(n));
+            }
+
+            lock.lock();
+            if (!backlog.empty() && !stop) {
+                auto retry = Clock::now() + kBackoff;
+                if (!items.empty()) retry = std::min(retry, items.next_wakeup());
+                cv.wait_until(lock, retry, woken);
+            }
+        }
+        lock.unlock();
+
+        // 已到期但还积压在本地的任务不能随 backlog 一起析构掉：阻塞地逐个交给线程池；
+        // 线程池已先关闭则无处可交，只能丢弃并计入 dropped()
+        for (auto &task : backlog) {
+            try {
+                pool.submit_by(task.deadline, std::move(task.fn));
+            } catch (const std::runtime_error &) {
+                shutdown_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    ThreadPool &pool;
+    TimerQueue items;
+    mutable std::mutex mtx;
+    std::condition_variable cv;
+    bool stop;
+    bool dirty = false;       // 有新任务加入，调度线程需要重新计算唤醒时间
+    std::shared_ptr<TimerOwnerLink> link; // 与定时器共享，析构后句柄仍可安全访问
+    std::size_t seq{0};
+    std::atomic<std::uint64_t> shutdown_dropped{0};
+    std::thread scheduler_thread; // 最后构造：线程启动时其它成员都已就绪
+};
+
+using Scheduler = BasicScheduler<HeapTimerQueue>;
+using WheelScheduler = BasicScheduler<TimerWheel>;
+
+} // namespace day14
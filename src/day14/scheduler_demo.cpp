@@ -0,0 +1,243 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "scheduler.hpp"
+#include "sharded_scheduler.hpp"
+
+using day14::ThreadPool;
+
+// 同一批一次性定时器分别跑在堆后端和时间轮后端上：
+// 检查全部触发、没有提前触发，并对比 post_after 的耗时
+template <class Sched, class... Args>
+void run_timers(const std::string &name, int n, Args&&... args) {
+    using Clock = std::chrono::steady_clock;
+    ThreadPool pool(4, 4096);
+    Sched sched(pool, std::forward<Args>(args)...);
+
+    std::atomic<int> fired{0};
+    std::atomic<int> early{0};
+    std::atomic<long long> max_late_us{0};
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> delay_ms(0, 300);
+
+    auto t0 = Clock::now();
+    for (int i = 0; i < n; ++i) {
+        auto delay = std::chrono::milliseconds(delay_ms(rng));
+        auto due = Clock::now() + delay;
+        sched.post_after(delay, [due, &fired, &early, &max_late_us]{
+            auto late = std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - due).count();
+            if (late < 0) early.fetch_add(1, std::memory_order_relaxed);
+            auto cur = max_late_us.load(std::memory_order_relaxed);
+            while (late > cur && !max_late_us.compare_exchange_weak(cur, late)) {}
+            fired.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    auto post_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - t0).count();
+
+    while (fired.load() < n && Clock::now() - t0 < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    sched.shutdown();
+    pool.shutdown();
+
+    std::cout << name << ": posted " << n << " in " << post_us << "us"
+              << ", fired=" << fired.load()
+              << ", early=" << early.load()
+              << ", max late=" << max_late_us.load() << "us\n";
+}
+
+// 模拟请求超时：绝大多数请求在超时前完成并取消定时器
+template <class Sched, class... Args>
+void run_cancel(const std::string &name, int n, Args&&... args) {
+    ThreadPool pool(2, 1024);
+    Sched sched(pool, std::forward<Args>(args)...);
+    std::atomic<int> fired{0};
+
+    std::vector<day14::TimerHandle> handles;
+    handles.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        handles.push_back(sched.post_after(std::chrono::milliseconds(200),
+                                           [&fired]{ ++fired; }));
+    }
+    int cancelled = 0;
+    for (int i = 0; i < n; ++i) {
+        if (i % 100 != 0 && handles[i].cancel()) ++cancelled;
+    }
+    // 续期一个：它应在 ~400ms 时才触发
+    handles[0].reschedule(std::chrono::milliseconds(400));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    int at_300ms = fired.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    // 一次性定时器触发后就离开了调度器：续期被拒绝，而不是取决于派发任务是否还持有它
+    bool again = handles[0].reschedule(std::chrono::milliseconds(100));
+    std::cout << name << ": cancelled=" << cancelled
+              << ", fired@300ms=" << at_300ms
+              << ", fired@500ms=" << fired.load()
+              << " (expect " << n / 100 - 1 << " then " << n / 100 << ")"
+              << ", pending=" << sched.pending()
+              << ", reschedule after fire=" << std::boolalpha << again << "\n";
+    sched.shutdown();
+    pool.shutdown();
+}
+
+// 周期 10ms 跑 1s：固定频率下触发次数应稳定在 ~100，且每次触发相对计划时间的偏差不累积
+void run_drift() {
+    using Clock = std::chrono::steady_clock;
+    ThreadPool pool(2, 64);
+    day14::Scheduler sched(pool);
+    std::atomic<int> ticks{0};
+    std::atomic<long long> last_phase_us{0};
+    auto start = Clock::now();
+    auto period = std::chrono::milliseconds(10);
+    sched.post_every(period, [&]{
+        int k = ++ticks;
+        auto planned = start + period * k;
+        last_phase_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - planned).count();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1005));
+    sched.shutdown();
+    pool.shutdown();
+    std::cout << "10ms x 1s: ticks=" << ticks.load()
+              << ", last tick offset=" << last_phase_us.load() << "us\n";
+}
+
+// 错过 tick 策略：计划在 t=0 触发、周期 10ms，但到 t=55ms 才处理这一拍
+void run_policy(const std::string &name, day14::MissedTick policy) {
+    using namespace std::chrono;
+    day14::TimerTask task([]{}, milliseconds(10), policy, nullptr);
+    day14::TimerClock::time_point t0{};
+    auto next = task.next_fire(t0, t0 + milliseconds(55));
+    std::cout << name << ": next fire at t="
+              << duration_cast<milliseconds>(next - t0).count() << "ms"
+              << ", missed=" << task.missed.load() << "\n";
+}
+
+// 到期风暴：多个线程各自挂一批同一时刻到期的定时器，统计从到期到全部执行完的时间
+template <class Sched, class... Args>
+void run_storm(const std::string &name, Args&&... args) {
+    using Clock = std::chrono::steady_clock;
+    const int posters = 4, per_thread = 50000;
+    ThreadPool pool(4, 1024);
+    Sched sched(pool, std::forward<Args>(args)...);
+    std::atomic<int> fired{0};
+
+    auto due = Clock::now() + std::chrono::milliseconds(300);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < posters; ++t) {
+        threads.emplace_back([&]{
+            for (int i = 0; i < per_thread; ++i) {
+                sched.post_after(due - Clock::now(), [&fired]{
+                    fired.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        });
+    }
+    for (auto &t : threads) t.join();
+    std::this_thread::sleep_until(due);
+    while (fired.load() < posters * per_thread &&
+           Clock::now() - due < std::chrono::seconds(5)) {
+        std::this_thread::yield();
+    }
+    auto drain_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - due).count();
+    sched.shutdown();
+    pool.shutdown();
+    std::cout << name << ": fired=" << fired.load() << " drained in " << drain_ms << "ms\n";
+}
+
+// 回调抛异常：异常不能逃出线程池的 worker，后面的定时器照常触发
+template <class Sched, class... Args>
+void run_throwing(const std::string &name, Args&&... args) {
+    ThreadPool pool(2, 64);
+    Sched sched(pool, std::forward<Args>(args)...);
+    std::atomic<int> after{0};
+    sched.post([]{ throw std::runtime_error("callback failed"); });
+    sched.post_after(std::chrono::milliseconds(5), []{ throw 42; });
+    sched.post_after(std::chrono::milliseconds(20), [&after]{ ++after; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sched.shutdown();
+    pool.shutdown();
+    std::cout << name << ": failed=" << sched.failed()
+              << ", later timer fired=" << after.load() << " (expect 2 and 1)\n";
+}
+
+// 池里已排着一堆批量任务时，带截止时间的超时处理仍能很快执行
+void run_deadline() {
+    using Clock = std::chrono::steady_clock;
+    ThreadPool pool(1, 4096);
+    day14::Scheduler sched(pool);
+    for (int i = 0; i < 300; ++i) {
+        pool.submit([]{ std::this_thread::sleep_for(std::chrono::microseconds(500)); });
+    }
+    std::atomic<long long> plain_us{0}, edf_us{0};
+    auto t0 = Clock::now();
+    auto since = [t0]{
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count();
+    };
+    sched.post_after(std::chrono::milliseconds(5), [&]{ plain_us = since(); });
+    sched.post_after_deadline(std::chrono::milliseconds(5), std::chrono::milliseconds(5),
+                              [&]{ edf_us = since(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    sched.shutdown();
+    pool.shutdown();
+    auto d = pool.deadline_stats();
+    std::cout << "timeout without deadline ran at " << plain_us.load() / 1000 << "ms, "
+              << "with deadline at " << edf_us.load() / 1000 << "ms"
+              << " (met=" << d.met << ", missed=" << d.missed << ")\n";
+}
+
+int main() {
+    const int n = 100000;
+    std::cout << "== Scheduler 后端对比 ==\n";
+    run_timers<day14::Scheduler>("heap ", n);
+    run_timers<day14::WheelScheduler>("wheel", n, std::chrono::milliseconds(1));
+
+    std::cout << "\n== 取消与续期 ==\n";
+    run_cancel<day14::Scheduler>("heap ", n);
+    run_cancel<day14::WheelScheduler>("wheel", n, std::chrono::milliseconds(1));
+
+    std::cout << "\n== 固定频率与错过 tick 策略 ==\n";
+    run_drift();
+    run_policy("skip    ", day14::MissedTick::kSkip);
+    run_policy("catch-up", day14::MissedTick::kCatchUp);
+    run_policy("coalesce", day14::MissedTick::kCoalesce);
+
+    std::cout << "\n== 回调抛异常 ==\n";
+    run_throwing<day14::Scheduler>("heap ");
+    run_throwing<day14::WheelScheduler>("wheel", std::chrono::milliseconds(1));
+
+    std::cout << "\n== 截止时间（EDF） ==\n";
+    run_deadline();
+
+    // 所有分片共用同一个线程池，空任务的风暴里瓶颈在池锁上，分片不会更快
+    //（见 sharded_scheduler.hpp 的“局限”）；这里只验证分片后全部到期任务都能派发完
+    std::cout << "\n== 到期风暴：单调度线程 vs 分片（" << std::thread::hardware_concurrency()
+              << " CPU，共享一个线程池）==\n";
+    run_storm<day14::WheelScheduler>("single ", std::chrono::milliseconds(1));
+    run_storm<day14::ShardedWheelScheduler>("sharded", 0, std::chrono::milliseconds(1));
+
+    std::cout << "\n== 时间轮周期任务 ==\n";
+    ThreadPool pool(2, 64);
+    day14::WheelScheduler sched(pool, std::chrono::milliseconds(1));
+    std::atomic<int> ticks{0};
+    auto every = sched.post_every(std::chrono::milliseconds(100), [&ticks]{ ++ticks; });
+    sched.post_after(std::chrono::minutes(90), []{ std::cout << "never\n"; }); // 高层时间轮
+    std::this_thread::sleep_for(std::chrono::milliseconds(550));
+    every.cancel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::cout << "periodic ticks in 550ms: " << ticks.load()
+              << " (cancelled, no more ticks), active=" << std::boolalpha << every.active() << "\n";
+    sched.shutdown();
+    pool.shutdown();
+    return 0;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "scheduler.hpp"
+
+// ShardedScheduler：按 CPU 分片的调度器
+// 典型用法：
+//   day14::ThreadPool pool(8, 4096);
+//   day14::ShardedWheelScheduler sched(pool, 0 /*=每核一片*/, std::chrono::milliseconds(1));
+//   auto h = sched.post_after(std::chrono::seconds(30), on_timeout);
+//
+// 设计要点：
+// - 每个分片就是一个完整的 BasicScheduler：自己的定时器结构、自己的锁、自己的调度线程，
+//   分片之间不共享任何可变状态，大量定时器同时到期时由多个线程并行派发
+// - post 落到调用线程当前所在 CPU 对应的分片（Linux 用 sched_getcpu，否则按线程 id 哈希），
+//   同一线程的定时器大多落在同一分片，锁基本不跨核争用
+// - TimerHandle 记住的是所属分片，cancel/reschedule 不需要知道分片号
+// - 派发沿用 BasicScheduler 的批量 + 非阻塞投递，线程池背压不会卡住任何分片
+// - 局限：分片只拆开了定时器结构和调度线程，到期任务最后仍进同一个 ThreadPool，
+//   池的互斥锁是所有分片共享的瓶颈。任务很轻的到期风暴里，派发吞吐受池锁限制，
+//   分片几乎没有收益（scheduler_demo 的“到期风暴”一节就是这种情况，单核上还会略慢）。
+//   收益出现在多核上多线程频繁 post/cancel 争用调度器锁、或单个调度线程的 collect 跟不上时；
+//   要让派发也随核数扩展，需要给每个分片配自己的线程池
+
+namespace day14 {
+
+template <class TimerQueue>
+class ShardedScheduler {
+public:
+    using Clock = TimerClock;
+    using Shard = BasicScheduler<TimerQueue>;
+
+    // shards 为 0 时取 hardware_concurrency；额外参数拷贝给每个分片的后端
+    template <class... QueueArgs>
+    explicit ShardedScheduler(ThreadPool &pool, std::size_t shards, const QueueArgs&... args) {
+        if (shards == 0) shards = std::thread::hardware_concurrency();
+        if (shards == 0) shards = 1;
+        this->shards.reserve(shards);
+        for (std::size_t i = 0; i < shards; ++i) {
+            this->shards.push_back(std::make_unique<Shard>(pool, args...));
+        }
+    }
+
+    ~ShardedScheduler() { shutdown(); }
+
+    ShardedScheduler(const ShardedScheduler&) = delete;
+    ShardedScheduler& operator=(const ShardedScheduler&) = delete;
+
+    void shutdown() {
+        for (auto &s : shards) s->shutdown();
+    }
+
+    template<typename F, typename... Args>
+    void post(F&& f, Args&&... args) {
+        local().post(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Rep, typename Period, typename F, typename... Args>
+    TimerHandle post_after(const std::chrono::duration<Rep, Period> &delay,
+                           F&& f, Args&&... args) {
+        return local().post_after(delay, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Rep, typename Period, typename F, typename... Args>
+    TimerHandle post_every(const std::chrono::duration<Rep, Period> &interval,
+                           F&& f, Args&&... args) {
+        return local().post_every(interval, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Rep, typename Period, typename F, typename... Args>
+    TimerHandle post_every(const std::chrono::duration<Rep, Period> &interval,
+                           MissedTick policy, F&& f, Args&&... args) {
+        return local().post_every(interval, policy,
+                                  std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Rep, typename Period, typename BRep, typename BPeriod,
+             typename F, typename... Args>
+    TimerHandle post_after_deadline(const std::chrono::duration<Rep, Period> &delay,
+                                    const std::chrono::duration<BRep, BPeriod> &budget,
+                                    F&& f, Args&&... args) {
+        return local().post_after_deadline(delay, budget,
+                                           std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Rep, typename Period, typename BRep, typename BPeriod,
+             typename F, typename... Args>
+    TimerHandle post_every_deadline(const std::chrono::duration<Rep, Period> &interval,
+                                    const std::chrono::duration<BRep, BPeriod> &budget,
+                                    F&& f, Args&&... args) {
+        return local().post_every_deadline(interval, budget,
+                                           std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    std::size_t shard_count() const noexcept { return shards.size(); }
+
+    std::size_t pending() const {
+        std::size_t n = 0;
+        for (const auto &s : shards) n += s->pending();
+        return n;
+    }
+
+    std::uint64_t dropped() const noexcept {
+        std::uint64_t n = 0;
+        for (const auto &s : shards) n += s->dropped();
+        return n;
+    }
+
+    std::uint64_t failed() const noexcept {
+        std::uint64_t n = 0;
+        for (const auto &s : shards) n += s->failed();
+        return n;
+    }
+
+private:
+    Shard &local() noexcept {
+        return *shards[current_slot() % shards.size()];
+    }
+
+    static std::size_t current_slot() noexcept {
+#ifdef __linux__
+        int cpu = sched_getcpu();
+        if (cpu >= 0) return static_cast<std::size_t>(cpu);
+#endif
+        return std::hash<std::thread::id>{}(std::this_thread::get_id());
+    }
+
+    std::vector<std::unique_ptr<Shard>> shards;
+};
+
+using ShardedHeapScheduler = ShardedScheduler<HeapTimerQueue>;
+using ShardedWheelScheduler = ShardedScheduler<TimerWheel>;
+
+} // namespace day14
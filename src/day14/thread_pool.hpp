@@ -0,0 +1,315 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "pool_metrics.hpp"
+#include "trace.hpp"
+
+// ThreadPool：有界任务队列 + future 的简化版线程池
+// 典型用法：
+//   day14::ThreadPool pool(4, 64);
+//   auto f = pool.submit([](int x){ return x * 2; }, 21);
+//   f.get(); // 42
+//
+// 设计要点：
+// - submit 在队列满时阻塞在 cv_not_full 上（背压），stop 后抛 runtime_error
+// - try_submit_bulk 一次加锁批量投递、从不阻塞，放不下的由调用方自己留着（调度器用它派发到期定时器）
+// - 带截止时间的任务（submit_by / PoolTask::deadline）进入按截止时间排序的 EDF 小顶堆，
+//   worker 总是先取其中最早截止的，再取普通 FIFO 任务；完成时统计是否错过截止时间。
+//   两类任务共用同一个容量上限
+// - 打开 DAY14_POOL_METRICS 时记录排队延迟、执行耗时、worker 忙闲、队列水位与 submit 阻塞时间，
+//   通过 metrics() 取快照；关闭时这些成员和埋点都不存在
+// - 任务执行和 submit 各有一个追踪 span（pool.task / pool.submit），Tracer 记录时可在时间线上看到
+//   每个 worker 的忙闲和提交方的背压等待（见 trace.hpp）
+
+namespace day14 {
+
+using PoolClock = std::chrono::steady_clock;
+
+// try_submit_bulk 的元素类型之一：可选截止时间的 fire-and-forget 任务
+struct PoolTask {
+    static constexpr PoolClock::time_point kNoDeadline = PoolClock::time_point::max();
+
+    std::function<void()> fn;
+    PoolClock::time_point deadline = kNoDeadline;
+};
+
+class ThreadPool {
+public:
+    ThreadPool(size_t threadCnt, size_t maxQueue)
+        : stop(false), max_queue_size(maxQueue)
+#if DAY14_POOL_METRICS
+        , worker_stats(threadCnt)
+#endif
+    {
+        for (size_t i = 0; i < threadCnt; ++i) {
+            workers.emplace_back([this, i]{ worker_loop(i); });
+        }
+    }
+
+    ~ThreadPool() { shutdown(); }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (stop) return;
+            stop = true;
+        }
+        cv_not_empty.notify_all();
+        cv_not_full.notify_all();
+        for (auto &t : workers) {
+            if (t.joinable()) t.join();
+        }
+    }
+
+    template<typename F, typename... Args>
+    auto submit(F&& f, Args&&... args)
+        -> std::future<typename std::invoke_result<F, Args...>::type>
+    {
+        return submit_by(PoolTask::kNoDeadline, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // 带截止时间提交：排在所有普通任务和更晚截止的任务前面
+    template<typename F, typename... Args>
+    auto submit_by(PoolClock::time_point deadline, F&& f, Args&&... args)
+        -> std::future<typename std::invoke_result<F, Args...>::type>
+    {
+        using return_type = typename std::invoke_result<F, Args...>::type;
+
+        auto task = std::make_shared<std::packaged_task<return_type()>>(
+            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+        );
+
+        std::future<return_type> res = task->get_future();
+
+        {
+            DAY14_TRACE_SPAN("pool.submit");
+            std::unique_lock<std::mutex> lock(mtx);
+#if DAY14_POOL_METRICS
+            // 只有真的要等时才取时间，快路径不多一次 now()
+            if (!stop && queued() >= max_queue_size) {
+                auto blocked_at = MetricsClock::now();
+                wait_not_full(lock);
+                submit_blocked += 1;
+                submit_blocked_ns += elapsed_ns(blocked_at, MetricsClock::now());
+            }
+#else
+            wait_not_full(lock);
+#endif
+            if (stop) {
+                throw std::runtime_error("ThreadPool stopped");
+            }
+            push_job(Job{[task]{ (*task)(); }, deadline});
+        }
+
+        cv_not_empty.notify_one();
+        return res;
+    }
+
+    // 非阻塞批量投递 fire-and-forget 任务（元素为 PoolTask 或可转成 std::function<void()> 的可调用对象）：
+    // 在一次临界区里按顺序尽量放入，返回实际放入的个数（队列满或已 stop 时少放/不放），已放入的元素被移走
+    template<typename It>
+    size_t try_submit_bulk(It first, It last) {
+        size_t n = 0;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (stop) return 0;
+            for (; first != last && queued() < max_queue_size; ++first, ++n) {
+                push_job(make_job(std::move(*first)));
+            }
+        }
+        // 放入几个就唤醒几个 worker（最多全部），不做无谓的 notify_all
+        for (size_t i = 0; i < n && i < workers.size(); ++i) cv_not_empty.notify_one();
+        return n;
+    }
+
+    size_t thread_count() const noexcept { return workers.size(); }
+
+    // 截止时间统计：按时完成/错过的个数，以及错过时的迟到时长分布
+    DeadlineSnapshot deadline_stats() const noexcept {
+        return DeadlineSnapshot{deadline_met.load(std::memory_order_relaxed),
+                                deadline_missed.load(std::memory_order_relaxed),
+                                lateness_hist.snapshot()};
+    }
+
+#if DAY14_POOL_METRICS
+    // 取一次指标快照；可在任意线程调用，开销是一次加锁 + 若干原子读
+    PoolMetricsSnapshot metrics() const {
+        PoolMetricsSnapshot s;
+        s.queue_wait = queue_wait_hist.snapshot();
+        s.run_time = run_time_hist.snapshot();
+        s.workers.reserve(worker_stats.size());
+        for (const auto &w : worker_stats) {
+            s.workers.push_back(WorkerSnapshot{
+                w.busy_ns.load(std::memory_order_relaxed),
+                w.idle_ns.load(std::memory_order_relaxed),
+                w.tasks.load(std::memory_order_relaxed)});
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        s.queue_high_water = queue_high_water;
+        s.submit_blocked = submit_blocked;
+        s.submit_blocked_ns = submit_blocked_ns;
+        return s;
+    }
+#endif
+
+private:
+    struct Job {
+        std::function<void()> fn;
+        PoolClock::time_point deadline;
+        std::uint64_t seq = 0;                 // 同一截止时间按提交顺序
+#if DAY14_POOL_METRICS
+        MetricsClock::time_point enqueued{};
+#endif
+    };
+
+    struct LaterDeadline {
+        bool operator()(const Job &a, const Job &b) const {
+            if (a.deadline != b.deadline) return a.deadline > b.deadline; // 小顶堆
+            return a.seq > b.seq;
+        }
+    };
+
+    static Job make_job(PoolTask &&t) { return Job{std::move(t.fn), t.deadline}; }
+
+    template<typename F>
+    static Job make_job(F &&f) {
+        return Job{std::function<void()>(std::forward<F>(f)), PoolTask::kNoDeadline};
+    }
+
+    size_t queued() const noexcept { return tasks.size() + deadline_tasks.size(); }
+
+    // 调用方持有 mtx
+    void push_job(Job job) {
+#if DAY14_POOL_METRICS
+        job.enqueued = MetricsClock::now();
+#endif
+        if (job.deadline == PoolTask::kNoDeadline) {
+            tasks.push(std::move(job));
+        } else {
+            job.seq = deadline_seq++;
+            deadline_tasks.push_back(std::move(job));
+            std::push_heap(deadline_tasks.begin(), deadline_tasks.end(), LaterDeadline{});
+        }
+#if DAY14_POOL_METRICS
+        if (queued() > queue_high_water) queue_high_water = queued();
+#endif
+    }
+
+    // 调用方持有 mtx 且队列非空：EDF 队列优先
+    Job pop_job() {
+        if (!deadline_tasks.empty()) {
+            std::pop_heap(deadline_tasks.begin(), deadline_tasks.end(), LaterDeadline{});
+            Job job = std::move(deadline_tasks.back());
+            deadline_tasks.pop_back();
+            return job;
+        }
+        Job job = std::move(tasks.front());
+        tasks.pop();
+        return job;
+    }
+
+    void wait_not_full(std::unique_lock<std::mutex> &lock) {
+        cv_not_full.wait(lock, [this]{
+            return stop || queued() < max_queue_size;
+        });
+    }
+
+    void account_deadline(PoolClock::time_point deadline) noexcept {
+        auto done = PoolClock::now();
+        if (done <= deadline) {
+            deadline_met.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            deadline_missed.fetch_add(1, std::memory_order_relaxed);
+            lateness_hist.record(elapsed_ns(deadline, done));
+        }
+    }
+
+    static void run(Job &job) {
+        DAY14_TRACE_SPAN("pool.task");
+        job.fn();
+    }
+
+    void worker_loop(size_t id) {
+#if DAY14_POOL_METRICS
+        auto &stats = worker_stats[id];
+#else
+        (void)id;
+#endif
+#if DAY14_TRACE
+        Tracer::name_this_thread("pool-worker-" + std::to_string(id));
+#endif
+        while (true) {
+            Job job;
+#if DAY14_POOL_METRICS
+            // 计时和直方图都放在临界区外：mtx 是所有 submit 争用的锁，持锁时间越短越好
+            auto idle_from = MetricsClock::now();
+#endif
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv_not_empty.wait(lock, [this]{
+                    return stop || queued() > 0;
+                });
+                if (stop && queued() == 0) return;
+                job = pop_job();
+                cv_not_full.notify_one();
+            }
+#if DAY14_POOL_METRICS
+            auto run_from = MetricsClock::now();
+            stats.idle_ns.fetch_add(elapsed_ns(idle_from, run_from), std::memory_order_relaxed);
+            queue_wait_hist.record(elapsed_ns(job.enqueued, run_from));
+            run(job);
+            auto run_ns = elapsed_ns(run_from, MetricsClock::now());
+            run_time_hist.record(run_ns);
+            stats.busy_ns.fetch_add(run_ns, std::memory_order_relaxed);
+            stats.tasks.fetch_add(1, std::memory_order_relaxed);
+#else
+            run(job);
+#endif
+            if (job.deadline != PoolTask::kNoDeadline) account_deadline(job.deadline);
+        }
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::queue<Job> tasks;                 // 普通任务：FIFO
+    std::vector<Job> deadline_tasks;       // 带截止时间的任务：EDF 小顶堆
+    std::uint64_t deadline_seq = 0;
+    mutable std::mutex mtx;
+    std::condition_variable cv_not_empty;
+    std::condition_variable cv_not_full;
+    bool stop;
+    size_t max_queue_size;
+
+    std::atomic<std::uint64_t> deadline_met{0};
+    std::atomic<std::uint64_t> deadline_missed{0};
+    LatencyHistogram lateness_hist;
+
+#if DAY14_POOL_METRICS
+    LatencyHistogram queue_wait_hist;
+    LatencyHistogram run_time_hist;
+    std::vector<WorkerCounters> worker_stats;
+    size_t queue_high_water = 0;          // 以下三项受 mtx 保护
+    std::uint64_t submit_blocked = 0;
+    std::uint64_t submit_blocked_ns = 0;
+#endif
+};
+
+} // namespace day14
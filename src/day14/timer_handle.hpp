@@ -0,0 +1,176 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+// TimerHandle：post_after / post_every 返回的定时器句柄
+// 典型用法：
+//   auto h = sched.post_after(std::chrono::seconds(5), on_timeout);
+//   ...请求提前完成...
+//   h.cancel();                                   // O(1)，不加锁
+//   h.reschedule(std::chrono::seconds(5));        // 续期：从现在起重新计时
+//
+// 设计要点：
+// - 定时器本体 TimerTask 由调度器持有（shared_ptr），句柄只持 weak_ptr，
+//   定时器触发/清理后句柄自然失效，不会延长 func 的生命周期
+// - cancel 只是打标记（惰性墓碑），到期时被跳过，不会再派发到线程池；
+//   墓碑过多时调度线程会成批清理，避免堆里积压大量过期条目
+// - reschedule 通过递增 generation 让旧条目失效，再插入一个新条目
+// - 是否还能操作只看定时器是否还在调度器里（TimerTask::queued）：一次性定时器一旦被取出派发，
+//   或取消后已被取走/清理，reschedule 一律返回 false、active() 为 false，
+//   与线程池里的派发任务是否还持有它无关。要再次触发请重新 post_after
+// - 定时器（以及线程池里尚未执行的派发任务）可能比调度器活得久，句柄只经由共享的
+//   TimerOwnerLink 访问调度器；调度器 shutdown 时断开链接，之后 cancel 只打标记，
+//   reschedule 返回 false
+// - 周期任务按固定频率对齐到首次触发时间（when_k = start + k * interval），不随派发延迟漂移；
+//   错过的 tick 如何处理由 MissedTick 决定
+
+namespace day14 {
+
+using TimerClock = std::chrono::steady_clock;
+
+struct TimerTask;
+
+// 周期任务错过 tick（调度线程或线程池来不及）时的处理策略
+enum class MissedTick {
+    kSkip,      // 跳过错过的 tick，下一次落在原相位上的下一个 tick（默认）
+    kCatchUp,   // 逐个补发错过的 tick，直到追上当前时间
+    kCoalesce,  // 错过的 tick 合并成这一次，之后从现在起重新计时
+};
+
+// 调度器对句柄暴露的最小接口
+class TimerOwner {
+public:
+    // 定时器已不在调度器里时返回 false
+    virtual bool rearm(const std::shared_ptr<TimerTask> &task, TimerClock::time_point when) = 0;
+
+protected:
+    ~TimerOwner() = default;
+};
+
+// 调度器与它的定时器共享的一小块状态，生命周期由 shared_ptr 管理，不随调度器析构
+class TimerOwnerLink {
+public:
+    explicit TimerOwnerLink(TimerOwner *owner) noexcept : owner_(owner) {}
+
+    // 取消只记一笔墓碑数，不碰调度器本身，调度器已析构也安全
+    void note_cancel() noexcept { tombstones.fetch_add(1, std::memory_order_relaxed); }
+
+    // 墓碑到期时被顺带取走，不再需要清理；与 cancel 的竞争下计数只是近似，不减到 0 以下
+    void note_reclaimed() noexcept {
+        auto n = tombstones.load(std::memory_order_relaxed);
+        while (n > 0 && !tombstones.compare_exchange_weak(n, n - 1, std::memory_order_relaxed)) {}
+    }
+
+    // 调度器已断开时返回 false；持锁调用保证 detach 返回后不会再有人进入 owner
+    bool rearm(const std::shared_ptr<TimerTask> &task, TimerClock::time_point when) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return owner_ && owner_->rearm(task, when);
+    }
+
+    // 调度器 shutdown 时调用，不能在持有调度器锁时调用（rearm 的加锁顺序是先本锁后调度器锁）
+    void detach() noexcept {
+        std::lock_guard<std::mutex> lock(mtx_);
+        owner_ = nullptr;
+    }
+
+    // 回调抛出异常时记一笔；异常本身被吞掉，不会逃出线程池的 worker
+    void note_failure() noexcept { failures.fetch_add(1, std::memory_order_relaxed); }
+
+    std::atomic<std::size_t> tombstones{0}; // 取消/重排留下的墓碑数（近似）
+    std::atomic<std::uint64_t> failures{0}; // 抛出异常的回调次数
+
+private:
+    std::mutex mtx_;
+    TimerOwner *owner_;
+};
+
+struct TimerTask {
+    std::function<void()> func;
+    TimerClock::duration interval;      // 0 表示一次性
+    MissedTick policy;
+    std::shared_ptr<TimerOwnerLink> owner;
+    std::atomic<bool> cancelled{false};
+    std::atomic<std::uint32_t> gen{0};  // 每次 reschedule 加一，旧条目随之失效
+    // 调度器里还有当前 generation 的条目（可能已取消）；只由调度器持锁修改，句柄无锁读取
+    std::atomic<bool> queued{true};
+    std::atomic<std::uint64_t> missed{0}; // 被跳过/合并的 tick 数
+    TimerClock::duration budget = TimerClock::duration::max(); // 到期后须在多久内完成；max 表示无截止时间
+
+    TimerTask(std::function<void()> f, TimerClock::duration iv, MissedTick p,
+              std::shared_ptr<TimerOwnerLink> o)
+        : func(std::move(f)), interval(iv), policy(p), owner(std::move(o)) {}
+
+    bool has_deadline() const noexcept { return budget != TimerClock::duration::max(); }
+
+    // 周期任务在 when 这一拍到期、当前时间为 now 时，计算下一拍
+    TimerClock::time_point next_fire(TimerClock::time_point when,
+                                     TimerClock::time_point now) noexcept {
+        auto next = when + interval;
+        if (next > now) return next;
+        switch (policy) {
+        case MissedTick::kCatchUp:
+            return next; // 仍然 <= now，会在同一批里再次到期
+        case MissedTick::kCoalesce:
+            missed.fetch_add(static_cast<std::uint64_t>((now - when) / interval),
+                             std::memory_order_relaxed);
+            return now + interval;
+        case MissedTick::kSkip:
+        default: {
+            auto k = (now - when) / interval + 1;
+            missed.fetch_add(static_cast<std::uint64_t>(k - 1), std::memory_order_relaxed);
+            return when + interval * k;
+        }
+        }
+    }
+};
+
+class TimerHandle {
+public:
+    TimerHandle() = default;
+    explicit TimerHandle(const std::shared_ptr<TimerTask> &task) : task_(task) {}
+
+    // 取消定时器；返回 true 表示这次调用真正取消了一个仍在等待的定时器
+    bool cancel() noexcept {
+        auto t = task_.lock();
+        if (!t || !t->queued.load(std::memory_order_acquire)) return false;
+        if (t->cancelled.exchange(true, std::memory_order_acq_rel)) return false;
+        t->owner->note_cancel();
+        return true;
+    }
+
+    // 从现在起 delay 后再触发（周期任务则以此为下一次触发点）；仍在调度器里的已取消定时器会被重新激活。
+    // 定时器已不在调度器里（一次性定时器已触发、取消后已被取走）或调度器已关闭时返回 false
+    template <typename Rep, typename Period>
+    bool reschedule(const std::chrono::duration<Rep, Period> &delay) {
+        auto t = task_.lock();
+        if (!t) return false;
+        return t->owner->rearm(t, TimerClock::now() + delay);
+    }
+
+    // 仍在调度器里等待触发且未取消
+    bool active() const noexcept {
+        auto t = task_.lock();
+        return t && t->queued.load(std::memory_order_acquire) &&
+               !t->cancelled.load(std::memory_order_acquire);
+    }
+
+    explicit operator bool() const noexcept { return active(); }
+
+    // 周期任务因 kSkip/kCoalesce 而少触发的次数
+    std::uint64_t missed_ticks() const noexcept {
+        auto t = task_.lock();
+        return t ? t->missed.load(std::memory_order_relaxed) : 0;
+    }
+
+private:
+    std::weak_ptr<TimerTask> task_;
+};
+
+} // namespace day14
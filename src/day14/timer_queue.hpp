@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "timer_handle.hpp"
+
+// Scheduler 的定时器存储后端
+// 后端需要提供（调用方负责加锁）：
+//   void push(TimerItem item);
+//   bool empty() const;  size_t size() const;
+//   Clock::time_point next_wakeup() const;       // 非空时：调度线程最晚应在何时醒来
+//   void pop_expired(Clock::time_point now, std::vector<TimerItem>& out, Resched resched);
+//       // 取出所有到期项（拷贝一份放进 out）；resched(item) 返回 true 时就地改好 item.when，
+//       // 后端复用原条目/节点重新插入，不再 pop 后再 push 一个新条目
+//   template <class Pred> size_t remove_if(Pred pred);  // 清理墓碑，返回删除条数
+//
+// HeapTimerQueue 是原来的小顶堆实现：push/pop O(log n)；
+// 时间轮实现见 timer_wheel.hpp。
+
+namespace day14 {
+
+struct TimerItem {
+    TimerClock::time_point when;
+    std::shared_ptr<TimerTask> task;
+    std::uint32_t gen;                  // 入队时 task 的 generation
+    std::size_t seq;                    // 打破同一时间的并列
+
+    // 是 task 当前 generation 的条目（没有被 reschedule 顶替）
+    bool current() const noexcept {
+        return task->gen.load(std::memory_order_acquire) == gen;
+    }
+
+    // 已取消或已被 reschedule 的条目都是墓碑
+    bool stale() const noexcept {
+        return task->cancelled.load(std::memory_order_acquire) ||
+               task->gen.load(std::memory_order_acquire) != gen;
+    }
+};
+
+class HeapTimerQueue {
+public:
+    using Clock = TimerClock;
+
+    void push(TimerItem item) {
+        items_.push_back(std::move(item));
+        std::push_heap(items_.begin(), items_.end(), Cmp{});
+    }
+
+    bool empty() const noexcept { return items_.empty(); }
+    std::size_t size() const noexcept { return items_.size(); }
+
+    Clock::time_point next_wakeup() const { return items_.front().when; }
+
+    template <class Resched>
+    void pop_expired(Clock::time_point now, std::vector<TimerItem> &out, Resched &&resched) {
+        while (!items_.empty() && items_.front().when <= now) {
+            // 用 vector 自己维护堆，才能就地修改/移动而不是拷贝 top()
+            std::pop_heap(items_.begin(), items_.end(), Cmp{});
+            auto &back = items_.back();
+            out.push_back(back); // 只是多一次 shared_ptr 引用计数
+            if (resched(back)) {
+                std::push_heap(items_.begin(), items_.end(), Cmp{});
+            } else {
+                items_.pop_back();
+            }
+        }
+    }
+
+    template <class Pred>
+    std::size_t remove_if(Pred pred) {
+        auto it = std::remove_if(items_.begin(), items_.end(), pred);
+        auto n = static_cast<std::size_t>(items_.end() - it);
+        items_.erase(it, items_.end());
+        std::make_heap(items_.begin(), items_.end(), Cmp{});
+        return n;
+    }
+
+private:
+    struct Cmp {
+        bool operator()(const TimerItem &a, const TimerItem &b) const {
+            if (a.when != b.when) return a.when > b.when; // 小顶堆
+            return a.seq > b.seq;
+        }
+    };
+
+    std::vector<TimerItem> items_;
+};
+
+} // namespace day14
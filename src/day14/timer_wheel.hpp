@@ -0,0 +1,350 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "timer_queue.hpp"
+
+// TimerWheel：分层哈希时间轮（hierarchical hashed timing wheel）
+// 典型用法（通过 Scheduler 间接使用）：
+//   day14::WheelScheduler sched(pool, std::chrono::milliseconds(1));
+//   sched.post_after(std::chrono::seconds(30), on_timeout);
+//
+// 设计要点：
+// - 时间离散为 tick（默认 1ms），第 0 层 256 个槽，每槽 1 tick；
+//   第 1..4 层各 64 个槽，每槽跨度依次 ×64，总跨度 2^32 tick（1ms 下约 49 天）
+// - 每个定时器是一个侵入式双向链表节点，插入/摘除都是 O(1)
+// - 第 0 层转一圈时把上一层对应槽“降级”（cascade）重新插入，每个定时器最多降级 4 次
+// - 每层都用位图记录非空槽，空转的 tick 和空槽的降级点都可直接跳过：
+//   调度线程只在下一个非空的第 0 层槽、或下一个非空高层槽降级时醒来，
+//   只挂着远期定时器时不会每 256 tick 醒一次
+// - 周期任务到期后直接改 expire 把同一个节点挂回去，不释放也不重新分配
+// - 节点从自带的节点池里取：池空时整块（slab）分配，块大小随总节点数翻倍（256 起、64K 封顶），
+//   触发/清理后节点回到空闲链表复用。挂 10 万个定时器只有十来次分配，而不是每个 push 一次 new；
+//   代价是节点内存只增不减，峰值过后一直留到时间轮析构
+
+namespace day14 {
+
+class TimerWheel {
+public:
+    using Clock = TimerClock;
+
+    explicit TimerWheel(std::chrono::nanoseconds tick = std::chrono::milliseconds(1),
+                        Clock::time_point origin = Clock::now())
+        : tick_(tick.count() > 0 ? tick : std::chrono::nanoseconds(1)), origin_(origin) {}
+
+    ~TimerWheel() { clear(); }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    void push(TimerItem item) {
+        Node *n = acquire(std::move(item));
+        n->expire = tick_ceil(n->item.when);
+        insert(n);
+        ++size_;
+    }
+
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t size() const noexcept { return size_; }
+
+    Clock::time_point next_wakeup() const {
+        if (due_.head) return tick_time(cur_);
+        return tick_time(next_event_tick());
+    }
+
+    template <class Resched>
+    void pop_expired(Clock::time_point now, std::vector<TimerItem> &out, Resched &&resched) {
+        std::uint64_t target = tick_floor(now);
+        while (cur_ < target) {
+            std::uint64_t next = next_event_tick();
+            if (next > target) {
+                cur_ = target; // (cur_, target] 之间既没有到期槽也没有降级点，可直接跳过
+                break;
+            }
+            cur_ = next;
+            advance_one();
+        }
+        // 补发（kCatchUp）的节点可能又落回 due_，直到全部追上 now
+        while (due_.head) drain(out, resched);
+    }
+
+    template <class Pred>
+    std::size_t remove_if(Pred pred) {
+        std::size_t n = purge(due_, pred);
+        for (auto &s : level0_) n += purge(s, pred);
+        for (auto &lvl : upper_) {
+            for (auto &s : lvl) n += purge(s, pred);
+        }
+        for (std::size_t i = 0; i < kL0Size; ++i) {
+            if (!level0_[i].head) bitmap_[i / 64] &= ~(std::uint64_t{1} << (i % 64));
+        }
+        for (std::size_t l = 0; l < kUpperLevels; ++l) {
+            for (std::size_t i = 0; i < kLnSize; ++i) {
+                if (!upper_[l][i].head) upper_bitmap_[l] &= ~(std::uint64_t{1} << i);
+            }
+        }
+        size_ -= n;
+        return n;
+    }
+
+    void clear() noexcept {
+        free_list(due_);
+        for (auto &s : level0_) free_list(s);
+        for (auto &lvl : upper_) {
+            for (auto &s : lvl) free_list(s);
+        }
+        bitmap_ = {};
+        upper_bitmap_ = {};
+        size_ = 0;
+    }
+
+private:
+    static constexpr unsigned kL0Bits = 8;
+    static constexpr unsigned kLnBits = 6;
+    static constexpr std::size_t kL0Size = std::size_t{1} << kL0Bits;
+    static constexpr std::size_t kLnSize = std::size_t{1} << kLnBits;
+    static constexpr std::size_t kUpperLevels = 4;
+    static constexpr std::uint64_t kMaxSpan =
+        std::uint64_t{1} << (kL0Bits + kLnBits * kUpperLevels);
+
+    struct List;
+
+    struct Node {
+        TimerItem item;
+        std::uint64_t expire; // 到期 tick
+        Node *prev;
+        Node *next;
+        List *owner;          // 所在链表，摘除时 O(1) 更新表头
+    };
+
+    struct List {
+        Node *head = nullptr;
+        Node *tail = nullptr;
+    };
+
+    static void link(List &l, Node *n) noexcept {
+        n->owner = &l;
+        n->next = nullptr;
+        n->prev = l.tail;
+        if (l.tail) l.tail->next = n; else l.head = n;
+        l.tail = n;
+    }
+
+    static void unlink(Node *n) noexcept {
+        List &l = *n->owner;
+        if (n->prev) n->prev->next = n->next; else l.head = n->next;
+        if (n->next) n->next->prev = n->prev; else l.tail = n->prev;
+        n->prev = n->next = nullptr;
+        n->owner = nullptr;
+    }
+
+    template <class Pred>
+    std::size_t purge(List &l, Pred &pred) {
+        std::size_t n = 0;
+        for (Node *cur = l.head; cur;) {
+            Node *next = cur->next;
+            if (pred(cur->item)) {
+                unlink(cur);
+                release(cur);
+                ++n;
+            }
+            cur = next;
+        }
+        return n;
+    }
+
+    void free_list(List &l) noexcept {
+        for (Node *n = l.head; n;) {
+            Node *next = n->next;
+            release(n);
+            n = next;
+        }
+        l = List{};
+    }
+
+    static constexpr std::size_t kSlabMin = 256;
+    static constexpr std::size_t kSlabMax = std::size_t{1} << 16;
+
+    Node *acquire(TimerItem &&item) {
+        if (!free_) grow();
+        Node *n = free_;
+        free_ = n->next;
+        n->item = std::move(item);
+        n->next = nullptr;
+        return n;
+    }
+
+    // 节点回到空闲链表；先放掉 item 里的 TimerTask，不能让池里的节点延长定时器的生命周期
+    void release(Node *n) noexcept {
+        n->item.task.reset();
+        n->prev = nullptr;
+        n->owner = nullptr;
+        n->next = free_;
+        free_ = n;
+    }
+
+    void grow() {
+        std::size_t count = std::min(kSlabMax, std::max(kSlabMin, pooled_));
+        slabs_.push_back(std::make_unique<Node[]>(count));
+        Node *slab = slabs_.back().get();
+        for (std::size_t i = count; i-- > 0;) {
+            slab[i].next = free_;
+            free_ = &slab[i];
+        }
+        pooled_ += count;
+    }
+
+    std::uint64_t tick_floor(Clock::time_point t) const noexcept {
+        if (t <= origin_) return 0;
+        return static_cast<std::uint64_t>((t - origin_) / tick_);
+    }
+
+    std::uint64_t tick_ceil(Clock::time_point t) const noexcept {
+        if (t <= origin_) return 0;
+        auto d = std::chrono::duration_cast<std::chrono::nanoseconds>(t - origin_);
+        return static_cast<std::uint64_t>((d + tick_ - std::chrono::nanoseconds(1)) / tick_);
+    }
+
+    Clock::time_point tick_time(std::uint64_t t) const noexcept {
+        return origin_ + std::chrono::duration_cast<Clock::duration>(tick_ * t);
+    }
+
+    void insert(Node *n) noexcept {
+        std::uint64_t e = n->expire;
+        if (e <= cur_) {
+            link(due_, n);
+            return;
+        }
+        std::uint64_t delta = e - cur_;
+        if (delta < kL0Size) {
+            std::size_t idx = e & (kL0Size - 1);
+            link(level0_[idx], n);
+            bitmap_[idx / 64] |= std::uint64_t{1} << (idx % 64);
+            return;
+        }
+        if (delta >= kMaxSpan) {
+            e = cur_ + kMaxSpan - 1; // 超出总跨度：先挂在最高层，降级时按真实 expire 重新定位
+            delta = kMaxSpan - 1;
+        }
+        for (std::size_t l = 0; l < kUpperLevels; ++l) {
+            unsigned shift = kL0Bits + kLnBits * static_cast<unsigned>(l);
+            if (delta < (std::uint64_t{1} << (shift + kLnBits))) {
+                std::size_t slot = static_cast<std::size_t>((e >> shift) & (kLnSize - 1));
+                link(upper_[l][slot], n);
+                upper_bitmap_[l] |= std::uint64_t{1} << slot;
+                return;
+            }
+        }
+    }
+
+    // 下一个需要处理的 tick：第 0 层下一个非空槽，或某个非空高层槽被降级的那一刻，取最早者
+    std::uint64_t next_event_tick() const noexcept {
+        std::uint64_t boundary = (cur_ | (kL0Size - 1)) + 1;
+        // 本圈内 cur_ 之后的非空槽一定早于任何降级点
+        std::size_t from = static_cast<std::size_t>((cur_ + 1) & (kL0Size - 1));
+        if (from != 0) {
+            std::size_t idx = first_l0_slot(from);
+            if (idx < kL0Size) return (cur_ & ~std::uint64_t{kL0Size - 1}) + idx;
+        }
+        // 其余第 0 层槽（下标 < from）在回绕之后才到
+        std::uint64_t best = ~std::uint64_t{0};
+        std::size_t idx = first_l0_slot(0);
+        if (idx < kL0Size) best = boundary + idx;
+        // 第 l 层的槽只在 2^shift 的整数倍上降级：从 cur_ 之后的第一个降级点起找第一个非空槽
+        for (std::size_t l = 0; l < kUpperLevels; ++l) {
+            std::uint64_t bits = upper_bitmap_[l];
+            if (!bits) continue;
+            unsigned shift = kL0Bits + kLnBits * static_cast<unsigned>(l);
+            std::uint64_t base = ((cur_ >> shift) + 1) << shift;
+            unsigned k0 = static_cast<unsigned>((base >> shift) & (kLnSize - 1));
+            std::uint64_t rotated = k0 ? (bits >> k0) | (bits << (kLnSize - k0)) : bits;
+            auto d = static_cast<std::uint64_t>(__builtin_ctzll(rotated));
+            best = std::min(best, base + (d << shift));
+        }
+        return best;
+    }
+
+    // 第 0 层 from 及之后第一个非空槽的下标，没有则返回 kL0Size
+    std::size_t first_l0_slot(std::size_t from) const noexcept {
+        for (std::size_t w = from / 64; w < bitmap_.size(); ++w) {
+            std::uint64_t bits = bitmap_[w];
+            if (w == from / 64) bits &= ~std::uint64_t{0} << (from % 64);
+            if (bits) return w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits));
+        }
+        return kL0Size;
+    }
+
+    // 处理 cur_ 这一 tick：必要时逐层降级，然后把第 0 层当前槽并入 due_
+    void advance_one() noexcept {
+        std::size_t idx = static_cast<std::size_t>(cur_ & (kL0Size - 1));
+        if (idx == 0) {
+            for (std::size_t l = 0; l < kUpperLevels; ++l) {
+                unsigned shift = kL0Bits + kLnBits * static_cast<unsigned>(l);
+                std::size_t slot = static_cast<std::size_t>((cur_ >> shift) & (kLnSize - 1));
+                upper_bitmap_[l] &= ~(std::uint64_t{1} << slot);
+                cascade(upper_[l][slot]); // 先清位：降级时可能有节点重新落回同一个槽
+                if (slot != 0) break;
+            }
+        }
+        List &l0 = level0_[idx];
+        for (Node *n = l0.head; n;) {
+            Node *next = n->next;
+            link(due_, n);
+            n = next;
+        }
+        l0 = List{};
+        bitmap_[idx / 64] &= ~(std::uint64_t{1} << (idx % 64));
+    }
+
+    void cascade(List &l) noexcept {
+        Node *n = l.head;
+        l = List{};
+        while (n) {
+            Node *next = n->next;
+            insert(n);
+            n = next;
+        }
+    }
+
+    template <class Resched>
+    void drain(std::vector<TimerItem> &out, Resched &resched) {
+        Node *n = due_.head;
+        due_ = List{};
+        while (n) {
+            Node *next = n->next;
+            out.push_back(n->item);
+            if (resched(n->item)) {
+                n->expire = tick_ceil(n->item.when);
+                insert(n); // 复用节点
+            } else {
+                release(n);
+                --size_;
+            }
+            n = next;
+        }
+    }
+
+    std::chrono::nanoseconds tick_;
+    Clock::time_point origin_;
+    std::uint64_t cur_ = 0;        // 已处理到的 tick
+    std::size_t size_ = 0;
+
+    List due_;                     // 已到期、等待取走
+    std::array<List, kL0Size> level0_{};
+    std::array<std::array<List, kLnSize>, kUpperLevels> upper_{};
+    std::array<std::uint64_t, kL0Size / 64> bitmap_{};
+    std::array<std::uint64_t, kUpperLevels> upper_bitmap_{}; // 每层 64 槽的非空位图
+
+    std::vector<std::unique_ptr<Node[]>> slabs_; // 节点池的整块内存，析构时一起释放
+    Node *free_ = nullptr;                       // 空闲节点链表（借用 next）
+    std::size_t pooled_ = 0;                     // 已分配的节点总数
+};
+
+} // namespace day14
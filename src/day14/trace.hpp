@@ -0,0 +1,389 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#endif
+
+// 热路径追踪：RAII span 记录 [开始, 结束) 的 TSC、线程、静态名字，后台线程转成 Chrome trace-event JSON
+// 典型用法：
+//   day14::Tracer::instance().start("trace.json");      // 开始记录
+//   {
+//       DAY14_TRACE_SPAN("parse");                        // 作用域结束时记一条
+//       ...
+//   }
+//   day14::Tracer::name_this_thread("io");               // 可选：时间线上显示的线程名
+//   day14::Tracer::instance().stop();                     // 写完收尾，用 ui.perfetto.dev 或 chrome://tracing 打开
+//
+// 设计要点：
+// - span 只读两次 rdtsc，结束时往本线程自己的环形缓冲写 24 字节，不加锁、不格式化、不做 I/O；
+//   没有 start 时构造只多一次 relaxed load
+// - 每线程一个 SPSC 环：写端是线程自己，读端是刷新线程；环满时丢弃并计数，热路径从不等待
+// - 刷新线程每 interval 把所有环倒出来，按启动时校准的 TSC 频率换算成微秒，批量写文件
+// - 名字只存指针，必须是字符串字面量之类的静态字符串
+// - 线程退出后它的环由注册表继续持有，倒空后才释放，退出前记下的 span 不会丢
+// - 编译时加 -DDAY14_TRACE=0 时 DAY14_TRACE_SPAN 展开为空，线程池、调度器里的埋点一并消失
+
+#ifndef DAY14_TRACE
+#define DAY14_TRACE 1
+#endif
+
+namespace day14 {
+
+inline std::uint64_t trace_ticks() noexcept {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+struct TraceEvent {
+    const char *name;
+    std::uint64_t begin;
+    std::uint64_t end;
+};
+
+// 单线程写、刷新线程读的事件环
+class TraceRing {
+public:
+    static constexpr std::size_t kCapacity = 16384;  // 2 的幂；每线程 384 KiB
+
+    TraceRing(std::uint64_t tid, std::string name)
+        : tid(tid), name(std::move(name)), buf_(new TraceEvent[kCapacity]) {}
+
+    bool push(const TraceEvent &e) noexcept {
+        auto head = head_.load(std::memory_order_relaxed);
+        if (head - cached_tail_ == kCapacity) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ == kCapacity) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        buf_[head & (kCapacity - 1)] = e;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 只由刷新线程调用
+    template <class F>
+    std::size_t drain(F &&f) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto head = head_.load(std::memory_order_acquire);
+        for (auto i = tail; i != head; ++i) f(buf_[i & (kCapacity - 1)]);
+        tail_.store(head, std::memory_order_release);
+        return static_cast<std::size_t>(head - tail);
+    }
+
+    std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    const std::uint64_t tid;
+    std::string name;                  // 受 Tracer 的注册表锁保护
+    bool name_written = false;         // 同上
+    std::atomic<bool> retired{false};  // 所属线程已退出
+
+private:
+    std::unique_ptr<TraceEvent[]> buf_;
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t cached_tail_ = 0;    // 写端缓存的读指针
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+class Tracer {
+public:
+    // 故意泄漏：线程可能在 main 返回后才退出，退出时还要访问注册表
+    static Tracer &instance() {
+        static Tracer *t = new Tracer;
+        return *t;
+    }
+
+    // 打开 path 开始记录；已在记录或文件打不开时返回 false
+    bool start(const std::string &path,
+               std::chrono::milliseconds interval = std::chrono::milliseconds(50)) {
+        std::lock_guard<std::mutex> guard(control_mtx_);
+        if (file_) return false;
+        file_ = std::fopen(path.c_str(), "w");
+        if (!file_) return false;
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file_);
+        first_event_ = true;
+        written_ = 0;
+
+        calibrate();
+        {
+            // 上一轮 stop 之后才结束的 span 还留在环里，时间基准已经不同，直接丢掉
+            std::lock_guard<std::mutex> lock(registry_mtx_);
+            for (auto &r : rings_) {
+                r->drain([](const TraceEvent &) {});
+                r->name_written = false;
+            }
+        }
+        stopping_ = false;
+        enabled_.store(true, std::memory_order_release);
+        flusher_ = std::thread([this, interval]{ flush_loop(interval); });
+        return true;
+    }
+
+    // 停止记录：刷新剩余事件、写结尾、关闭文件
+    void stop() {
+        std::lock_guard<std::mutex> guard(control_mtx_);
+        if (!file_) return;
+        enabled_.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(flush_mtx_);
+            stopping_ = true;
+        }
+        flush_cv_.notify_one();
+        flusher_.join();
+        flush_once();
+        std::fputs("\n]}\n", file_);
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    bool enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    void record(const char *name, std::uint64_t begin, std::uint64_t end) noexcept {
+        if (auto *ring = local()) ring->push(TraceEvent{name, begin, end});
+    }
+
+    // 设置当前线程在时间线上的名字；不会为此分配环
+    static void name_this_thread(std::string name) {
+        auto &slot = local_slot();
+        slot.name = std::move(name);
+        if (slot.ring) {
+            auto &t = instance();
+            std::lock_guard<std::mutex> lock(t.registry_mtx_);
+            slot.ring->name = slot.name;
+            slot.ring->name_written = false;
+        }
+    }
+
+    // 已写入文件的事件数（本轮）、因环满丢弃的事件数（累计）
+    std::uint64_t written() const noexcept { return written_.load(std::memory_order_relaxed); }
+
+    std::uint64_t dropped() const {
+        std::lock_guard<std::mutex> lock(registry_mtx_);
+        return dropped_retired_ + sum_dropped();
+    }
+
+private:
+    Tracer() = default;
+
+    struct LocalSlot {
+        std::shared_ptr<TraceRing> ring;
+        std::string name;
+        ~LocalSlot() {
+            if (ring) ring->retired.store(true, std::memory_order_release);
+        }
+    };
+
+    static LocalSlot &local_slot() {
+        thread_local LocalSlot slot;
+        return slot;
+    }
+
+    // 本线程的环，第一次记录时注册；分配失败就放弃这条事件
+    TraceRing *local() noexcept {
+        auto &slot = local_slot();
+        if (slot.ring) return slot.ring.get();
+        try {
+            auto ring = std::make_shared<TraceRing>(current_tid(), slot.name);
+            std::lock_guard<std::mutex> lock(registry_mtx_);
+            rings_.push_back(ring);
+            slot.ring = std::move(ring);
+        } catch (...) {
+            return nullptr;
+        }
+        return slot.ring.get();
+    }
+
+    static std::uint64_t current_tid() noexcept {
+#ifdef __linux__
+        return static_cast<std::uint64_t>(::syscall(SYS_gettid));
+#else
+        return std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+    }
+
+    static std::uint64_t current_pid() noexcept {
+#ifdef __linux__
+        return static_cast<std::uint64_t>(::getpid());
+#else
+        return 1;
+#endif
+    }
+
+    // 在 ~10ms 的窗口两端同时读 TSC 和 steady_clock，得到每 tick 的纳秒数
+    void calibrate() {
+        using Clock = std::chrono::steady_clock;
+        auto c0 = Clock::now();
+        auto t0 = trace_ticks();
+        auto c1 = c0;
+        while (c1 - c0 < std::chrono::milliseconds(10)) c1 = Clock::now();
+        auto t1 = trace_ticks();
+        double ns = std::chrono::duration<double, std::nano>(c1 - c0).count();
+        ns_per_tick_ = t1 > t0 ? ns / static_cast<double>(t1 - t0) : 1.0;
+        base_ = t1;
+    }
+
+    void flush_loop(std::chrono::milliseconds interval) {
+        std::unique_lock<std::mutex> lock(flush_mtx_);
+        while (!stopping_) {
+            flush_cv_.wait_for(lock, interval, [this]{ return stopping_; });
+            if (stopping_) break;
+            lock.unlock();
+            flush_once();
+            lock.lock();
+        }
+    }
+
+    // 倒空所有环、写文件；同一时刻只有刷新线程或 stop 中的线程调用
+    void flush_once() {
+        std::vector<std::shared_ptr<TraceRing>> rings;
+        out_.clear();
+        {
+            std::lock_guard<std::mutex> lock(registry_mtx_);
+            rings = rings_;
+            for (auto &r : rings) {
+                if (r->name_written || r->name.empty()) continue;
+                append_separator();
+                out_ += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":";
+                out_ += std::to_string(pid_);
+                out_ += ",\"tid\":";
+                out_ += std::to_string(r->tid);
+                out_ += ",\"args\":{\"name\":\"";
+                append_escaped(r->name.c_str());
+                out_ += "\"}}";
+                r->name_written = true;
+            }
+        }
+
+        std::uint64_t n = 0;
+        for (auto &r : rings) {
+            // 先读 retired 再倒空：读到 true 时线程已不会再写，倒完就可以释放
+            bool retired = r->retired.load(std::memory_order_acquire);
+            r->drain([&](const TraceEvent &e) {
+                if (e.begin < base_ || e.end < e.begin) return; // 开始记录之前的残留
+                append_event(e, r->tid);
+                ++n;
+            });
+            if (retired) {
+                std::lock_guard<std::mutex> lock(registry_mtx_);
+                dropped_retired_ += r->dropped();
+                for (auto it = rings_.begin(); it != rings_.end(); ++it) {
+                    if (*it == r) { rings_.erase(it); break; }
+                }
+            }
+        }
+
+        if (!out_.empty()) {
+            std::fwrite(out_.data(), 1, out_.size(), file_);
+            std::fflush(file_);
+        }
+        written_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void append_separator() {
+        if (!first_event_) out_ += ",\n";
+        first_event_ = false;
+    }
+
+    void append_escaped(const char *s) {
+        for (; *s; ++s) {
+            if (*s == '"' || *s == '\\') out_ += '\\';
+            out_ += *s;
+        }
+    }
+
+    // 完整事件（ph = X）：ts、dur 单位都是微秒
+    void append_event(const TraceEvent &e, std::uint64_t tid) {
+        char num[64];
+        append_separator();
+        out_ += "{\"name\":\"";
+        append_escaped(e.name);
+        out_ += "\",\"ph\":\"X\",\"pid\":";
+        out_ += std::to_string(pid_);
+        out_ += ",\"tid\":";
+        out_ += std::to_string(tid);
+        std::snprintf(num, sizeof(num), ",\"ts\":%.3f,\"dur\":%.3f}",
+                      static_cast<double>(e.begin - base_) * ns_per_tick_ / 1000.0,
+                      static_cast<double>(e.end - e.begin) * ns_per_tick_ / 1000.0);
+        out_ += num;
+    }
+
+    std::uint64_t sum_dropped() const {
+        std::uint64_t n = 0;
+        for (const auto &r : rings_) n += r->dropped();
+        return n;
+    }
+
+    std::atomic<bool> enabled_{false};
+
+    mutable std::mutex registry_mtx_;
+    std::vector<std::shared_ptr<TraceRing>> rings_;
+    std::uint64_t dropped_retired_ = 0;          // 已释放的环丢弃的事件数
+
+    std::mutex control_mtx_;                     // 串行化 start / stop
+    std::mutex flush_mtx_;
+    std::condition_variable flush_cv_;
+    bool stopping_ = false;
+    std::thread flusher_;
+
+    // 以下只由刷新线程（或 join 之后的 stop）访问
+    std::FILE *file_ = nullptr;
+    std::string out_;
+    bool first_event_ = true;
+    std::uint64_t base_ = 0;
+    double ns_per_tick_ = 1.0;
+    const std::uint64_t pid_ = current_pid();
+    std::atomic<std::uint64_t> written_{0};
+};
+
+// RAII span：构造时若正在记录就取开始时间，析构时记一条事件
+class TraceSpan {
+public:
+    explicit TraceSpan(const char *name) noexcept
+        : name_(Tracer::instance().enabled() ? name : nullptr),
+          begin_(name_ ? trace_ticks() : 0) {}
+
+    ~TraceSpan() {
+        if (name_) Tracer::instance().record(name_, begin_, trace_ticks());
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char *name_;
+    std::uint64_t begin_;
+};
+
+} // namespace day14
+
+#if DAY14_TRACE
+#define DAY14_TRACE_CONCAT_IMPL(a, b) a##b
+#define DAY14_TRACE_CONCAT(a, b) DAY14_TRACE_CONCAT_IMPL(a, b)
+#define DAY14_TRACE_SPAN(name) ::day14::TraceSpan DAY14_TRACE_CONCAT(day14_trace_span_, __LINE__)(name)
+#else
+#define DAY14_TRACE_SPAN(name) ((void)0)
+#endif
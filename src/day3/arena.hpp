@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+// Arena：请求级的单调（bump-pointer）分配器，实现 std::pmr::memory_resource
+// 典型用法：
+//   day3::Arena arena(64 * 1024);                          // 每个工作线程一块，反复使用
+//   {
+//       day3::Arena::Scope scope(arena);                   // 出作用域时 reset
+//       std::pmr::vector<std::pmr::string> words(&arena);  // 容器及其元素都从 arena 取内存
+//       ...处理一个请求...
+//   }                                                      // 整个请求的内存一次归还
+//
+// 设计要点：
+// - 分配只是把指针往前推（对齐后），deallocate 什么都不做；reset() 把指针拨回起点，O(1)
+// - 主缓冲区构造时一次申请（或由调用方提供），之后每个请求都复用，不碰全局堆
+// - 主缓冲区用完时：给了 upstream 就向它申请溢出块（记在链表里，reset 时统一还掉），
+//   没给 upstream（nullptr）就抛 std::bad_alloc，便于发现请求超出预算
+// - 与 std::pmr::monotonic_buffer_resource 的区别：溢出是可选的，并且 reset 后主缓冲区立即可用；
+//   high_water() 记录历史最大用量，用来调主缓冲区大小
+// - 非线程安全：一个 arena 只给一个线程/一个请求用
+
+namespace day3 {
+
+class Arena : public std::pmr::memory_resource {
+public:
+    // 自己持有 capacity 字节的主缓冲区；upstream 为 nullptr 表示不允许溢出
+    explicit Arena(std::size_t capacity,
+                   std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+        : upstream_(upstream),
+          begin_(static_cast<std::byte *>(::operator new(capacity))),
+          end_(begin_ + capacity),
+          cur_(begin_),
+          owns_buffer_(true) {}
+
+    // 使用调用方提供的缓冲区（例如栈上数组），不负责释放它
+    Arena(void *buffer, std::size_t size,
+          std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) noexcept
+        : upstream_(upstream),
+          begin_(static_cast<std::byte *>(buffer)),
+          end_(begin_ + size),
+          cur_(begin_),
+          owns_buffer_(false) {}
+
+    ~Arena() override {
+        release_overflow();
+        if (owns_buffer_) ::operator delete(begin_);
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // 作废本 arena 上分配的全部内存：拨回指针，归还溢出块
+    void reset() noexcept {
+        note_high_water();
+        release_overflow();
+        cur_ = begin_;
+    }
+
+    // 主缓冲区已用字节（不含溢出块）
+    std::size_t used() const noexcept { return static_cast<std::size_t>(cur_ - begin_); }
+    std::size_t capacity() const noexcept { return static_cast<std::size_t>(end_ - begin_); }
+    // 当前挂着的溢出块字节数
+    std::size_t overflow_bytes() const noexcept { return overflow_bytes_; }
+    // 历次 reset 前的最大用量（主缓冲区 + 溢出）
+    std::size_t high_water() const noexcept {
+        auto now = used() + overflow_bytes_;
+        return now > high_water_ ? now : high_water_;
+    }
+
+    // RAII：出作用域时 reset
+    class Scope {
+    public:
+        explicit Scope(Arena &a) noexcept : arena_(a) {}
+        ~Scope() { arena_.reset(); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Arena &arena_;
+    };
+
+protected:
+    void *do_allocate(std::size_t bytes, std::size_t align) override {
+        if (void *p = bump(cur_, end_, bytes, align)) return p;
+        if (!upstream_) throw std::bad_alloc();
+        return allocate_overflow(bytes, align);
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    // 溢出块头部：记录大小与对齐，reset 时按原参数还给 upstream
+    struct Overflow {
+        Overflow *next;
+        std::size_t size;
+        std::size_t align;
+    };
+
+    static void *bump(std::byte *&cur, std::byte *end, std::size_t bytes, std::size_t align) noexcept {
+        auto addr = reinterpret_cast<std::uintptr_t>(cur);
+        auto aligned = (addr + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1);
+        auto avail = reinterpret_cast<std::uintptr_t>(end);
+        if (aligned > avail || avail - aligned < bytes) return nullptr;
+        cur = reinterpret_cast<std::byte *>(aligned + bytes);
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    // 每个溢出分配单独向 upstream 要一块（请求超预算本来就是少数情况）
+    void *allocate_overflow(std::size_t bytes, std::size_t align) {
+        std::size_t a = align > alignof(Overflow) ? align : alignof(Overflow);
+        std::size_t header = (sizeof(Overflow) + a - 1) / a * a;
+        std::size_t size = header + bytes;
+        auto *raw = static_cast<std::byte *>(upstream_->allocate(size, a));
+        auto *node = ::new (static_cast<void *>(raw)) Overflow{overflow_, size, a};
+        overflow_ = node;
+        overflow_bytes_ += bytes;
+        return raw + header;
+    }
+
+    void release_overflow() noexcept {
+        while (overflow_) {
+            Overflow *next = overflow_->next;
+            upstream_->deallocate(overflow_, overflow_->size, overflow_->align);
+            overflow_ = next;
+        }
+        overflow_bytes_ = 0;
+    }
+
+    void note_high_water() noexcept {
+        auto now = used() + overflow_bytes_;
+        if (now > high_water_) high_water_ = now;
+    }
+
+    std::pmr::memory_resource *upstream_;
+    std::byte *begin_;
+    std::byte *end_;
+    std::byte *cur_;
+    bool owns_buffer_;
+    Overflow *overflow_ = nullptr;
+    std::size_t overflow_bytes_ = 0;
+    std::size_t high_water_ = 0;
+};
+
+} // namespace day3
@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena.hpp"
+
+// 模拟一个请求：按空格切词（test1 的 count_words），每个词加前缀后存起来，再 join_strings 成一行。
+// 同一段逻辑分别用 std::string/vector（逐个 free）和 pmr + Arena（请求结束一次 reset）跑
+using Clock = std::chrono::steady_clock;
+
+static const std::string_view kLine =
+    "GET /api/v1/orders?customer=10086&status=shipped HTTP/1.1 host example.com "
+    "user-agent curl/8.0 accept application/json x-request-id 3f2a9c7e-41d0";
+
+template <class String, class Vector, class Alloc>
+static std::size_t handle_request(std::string_view line, const Alloc &alloc) {
+    Vector words(alloc);
+    std::size_t i = 0;
+    while (i < line.size()) {
+        while (i < line.size() && line[i] == ' ') ++i;
+        std::size_t j = i;
+        while (j < line.size() && line[j] != ' ') ++j;
+        if (j > i) {
+            String w("token:", alloc);   // 加前缀，确保超过 SSO 长度，真的走分配器
+            w.append(line.substr(i, j - i));
+            words.push_back(std::move(w));
+        }
+        i = j;
+    }
+    String joined(alloc);
+    for (std::size_t k = 0; k < words.size(); ++k) {
+        if (k) joined += ", ";
+        joined += words[k];
+    }
+    return joined.size();
+}
+
+int main() {
+    const int requests = 200000;
+    std::size_t sink = 0;
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < requests; ++r) {
+        sink += handle_request<std::string, std::vector<std::string>>(kLine, std::allocator<char>());
+    }
+    double heap_ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / requests;
+
+    day3::Arena arena(16 * 1024);
+    t0 = Clock::now();
+    for (int r = 0; r < requests; ++r) {
+        day3::Arena::Scope scope(arena);
+        sink += handle_request<std::pmr::string, std::pmr::vector<std::pmr::string>>(
+            kLine, std::pmr::polymorphic_allocator<char>(&arena));
+    }
+    double arena_ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / requests;
+
+    std::cout << "== 每个请求耗时（ns） ==\n"
+              << "std::allocator : " << heap_ns << "\n"
+              << "arena + reset  : " << arena_ns << "\n"
+              << "arena high water " << arena.high_water() << " / " << arena.capacity()
+              << " bytes (checksum " << sink << ")\n";
+
+    std::cout << "\n== 主缓冲区不够时 ==\n";
+    day3::Arena small(256);
+    {
+        day3::Arena::Scope scope(small);
+        std::pmr::vector<std::pmr::string> v(&small);
+        for (int i = 0; i < 8; ++i) v.emplace_back("a string that is longer than SSO #" + std::to_string(i));
+        std::cout << "with upstream: used " << small.used() << ", overflow " << small.overflow_bytes() << "\n";
+    }
+    std::cout << "after reset: used " << small.used() << ", overflow " << small.overflow_bytes() << "\n";
+
+    alignas(std::max_align_t) std::byte stack_buf[256];
+    day3::Arena strict(stack_buf, sizeof(stack_buf), nullptr);
+    try {
+        std::pmr::vector<int> v(&strict);
+        for (int i = 0; i < 1000; ++i) v.push_back(i);
+    } catch (const std::bad_alloc &) {
+        std::cout << "no upstream: bad_alloc after using " << strict.used() << " bytes\n";
+    }
+    return 0;
+}
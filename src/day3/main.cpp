@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "slab_pool.hpp"
+
+// training/test0.cpp 的 Buffer_r5_good：每次构造/拷贝都 new int[n]
+struct HeapBuffer {
+    int *data;
+    std::size_t size;
+
+    explicit HeapBuffer(std::size_t n) : data(new int[n]), size(n) {}
+    HeapBuffer(const HeapBuffer &o) : data(new int[o.size]), size(o.size) {
+        std::copy(o.data, o.data + size, data);
+    }
+    HeapBuffer(HeapBuffer &&o) noexcept : data(o.data), size(o.size) {
+        o.data = nullptr;
+        o.size = 0;
+    }
+    ~HeapBuffer() { delete[] data; }
+};
+
+// 同样的 Rule of Five，只是内存来自 pool_allocator
+struct PooledBuffer {
+    using Alloc = day3::pool_allocator<int>;
+
+    int *data;
+    std::size_t size;
+
+    explicit PooledBuffer(std::size_t n) : data(Alloc().allocate(n)), size(n) {}
+    PooledBuffer(const PooledBuffer &o) : data(Alloc().allocate(o.size)), size(o.size) {
+        std::copy(o.data, o.data + size, data);
+    }
+    PooledBuffer(PooledBuffer &&o) noexcept : data(o.data), size(o.size) {
+        o.data = nullptr;
+        o.size = 0;
+    }
+    ~PooledBuffer() {
+        if (data) Alloc().deallocate(data, size);
+    }
+};
+
+// src/day2 的 Hybrid 持有一个 new int(v)，换成 pool_new/pool_delete
+struct PooledHybrid {
+    explicit PooledHybrid(int v) : data(day3::pool_new<int>(v)) {}
+    PooledHybrid(const PooledHybrid &o) : data(o.data ? day3::pool_new<int>(*o.data) : nullptr) {}
+    PooledHybrid(PooledHybrid &&o) noexcept : data(o.data) { o.data = nullptr; }
+    ~PooledHybrid() { day3::pool_delete(data); }
+    int *data;
+};
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<long> sink{0}; // 让循环结果有去处，不被整体优化掉
+
+// 每轮构造一个 n 元素缓冲区并拷贝一次，threads 个线程并发
+template <class Buf>
+static double bench(std::size_t n, int threads, long rounds) {
+    auto t0 = Clock::now();
+    std::vector<std::thread> ts;
+    for (int t = 0; t < threads; ++t) {
+        ts.emplace_back([=]{
+            long sum = 0;
+            for (long i = 0; i < rounds; ++i) {
+                Buf a(n);
+                a.data[0] = static_cast<int>(i);
+                Buf b(a);
+                sum += b.data[0];
+            }
+            sink.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    for (auto &t : ts) t.join();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+    return ns / static_cast<double>(rounds * threads);
+}
+
+int main() {
+    auto &pool = day3::SlabPool::instance();
+    const long rounds = 1000000;
+
+    std::cout << "== new[] vs pool_allocator (ns/round: 构造 + 拷贝) ==\n";
+    for (int threads : {1, 4}) {
+        for (std::size_t n : {4u, 16u, 256u}) {
+            double heap = bench<HeapBuffer>(n, threads, rounds);
+            double pooled = bench<PooledBuffer>(n, threads, rounds);
+            std::cout << threads << " threads, n=" << n << ": new[] " << heap
+                      << "  pool " << pooled << "\n";
+        }
+    }
+
+    std::cout << "\n== 块复用：热身之后 slab 不再增长 ==\n";
+    auto churn = [] {
+        std::vector<PooledHybrid> hs;
+        for (int i = 0; i < 1000; ++i) hs.emplace_back(i);
+        std::list<int, day3::pool_allocator<int>> l(1000, 7);
+        std::vector<std::string, day3::pool_allocator<std::string>> v(100, "payload");
+        return hs.size() + l.size() + v.size();
+    };
+    churn();
+    auto warm = pool.slab_bytes();
+    std::size_t total = 0;
+    for (int i = 0; i < 1000; ++i) total += churn();
+    std::cout << "slab bytes after warmup=" << warm << ", after 1000 more rounds="
+              << pool.slab_bytes() << " (elements " << total << ")\n";
+    return 0;
+}
@@ -0,0 +1,49 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "${BASH_SOURCE[0]%/*}" && pwd)"
+BUILD_DIR="${SCRIPT_DIR}/../build/day3"
+SRC_DIR="${SCRIPT_DIR}"
+
+usage() {
+  cat <<'EOF'
+用法: ./run.sh [slab|arena|sbo|all]
+  slab  编译运行 slab 内存池示例（new[] 对比 pool_allocator、块复用）
+  arena 编译运行请求级 arena 示例（std::allocator 对比 pmr + 单调 arena）
+  sbo   编译运行 SmallBuffer 示例（小尺寸内联、赋值复用容量，统计堆分配次数）
+  all   编译运行全部示例（默认）
+EOF
+}
+
+build() {
+  mkdir -p "${BUILD_DIR}"
+  local target="$1" src="$2"; shift 2
+  echo "[BUILD] ${src} -> ${target}"
+  g++ -std=c++17 -O0 -g -Wall -Wextra -pedantic -pthread "$@" \
+      "${SRC_DIR}/${src}" -o "${BUILD_DIR}/${target}"
+}
+
+run_slab() {
+  build "slab_pool" "main.cpp" -O2
+  echo "[RUN ] slab_pool" && "${BUILD_DIR}/slab_pool"
+}
+
+run_arena() {
+  build "arena" "arena_demo.cpp" -O2
+  echo "[RUN ] arena" && "${BUILD_DIR}/arena"
+}
+
+run_sbo() {
+  build "small_buffer" "small_buffer_demo.cpp" -O2
+  echo "[RUN ] small_buffer" && "${BUILD_DIR}/small_buffer"
+}
+
+choice=${1:-all}
+case "${choice}" in
+  slab) run_slab ;;
+  arena) run_arena ;;
+  sbo)  run_sbo ;;
+  all)  run_slab; run_arena; run_sbo ;;
+  -h|--help) usage ;;
+  *) usage; exit 1 ;;
+esac
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// SlabPool：按尺寸分级的 slab 内存池 + 线程本地缓存
+// 典型用法：
+//   void *p = day3::SlabPool::instance().allocate(48);     // 落在 64 字节这一级
+//   day3::SlabPool::instance().deallocate(p, 48);           // 必须带上申请时的大小
+//   std::vector<int, day3::pool_allocator<int>> v;          // 标准容器直接用
+//   int *x = day3::pool_new<int>(42); day3::pool_delete(x); // 单个对象，替代 new int(v)
+//
+// 设计要点：
+// - 尺寸分级：8, 16, 32 ... 4096 字节（2 的幂），超过 4096 或对齐要求超过 16 的直接走全局 operator new
+// - 每一级向全局堆一次申请 64 KiB 的 slab，切成等长块；块释放后挂回空闲链表（块本身存 next 指针），
+//   之后的申请直接复用，不再碰全局堆
+// - 每个线程一份本地空闲链表（thread_local），快路径不加锁；本地空了从中心链表一次拿一批，
+//   本地攒多了一次还一批，中心链表按级别各有一把锁
+// - slab 只增不还：池子是进程级单例且故意不析构，线程退出时把本地缓存还给中心链表，
+//   避免与静态对象析构顺序纠缠
+
+namespace day3 {
+
+class SlabPool {
+public:
+    static constexpr std::size_t kMinBlock   = 8;
+    static constexpr std::size_t kMaxBlock   = 4096;
+    static constexpr std::size_t kClasses    = 10;         // 8 << 0 ... 8 << 9
+    static constexpr std::size_t kSlabBytes  = 64 * 1024;
+    static constexpr std::size_t kBatch      = 32;         // 线程缓存与中心链表之间一次搬运的块数
+    static constexpr std::size_t kMaxAlign   = alignof(std::max_align_t);
+
+    static SlabPool &instance() {
+        static SlabPool *pool = new SlabPool; // 故意泄漏：其它静态对象析构时仍可能归还内存
+        return *pool;
+    }
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    void *allocate(std::size_t bytes, std::size_t align = kMaxAlign) {
+        if (!pooled(bytes, align)) return ::operator new(bytes, std::align_val_t{align});
+        auto cls = class_of(bytes);
+        auto &cache = local().lists[cls];
+        if (!cache.head) refill(cls, cache);
+        Block *b = cache.head;
+        cache.head = b->next;
+        --cache.count;
+        return b;
+    }
+
+    void deallocate(void *p, std::size_t bytes, std::size_t align = kMaxAlign) noexcept {
+        if (!p) return;
+        if (!pooled(bytes, align)) {
+            ::operator delete(p, std::align_val_t{align});
+            return;
+        }
+        auto cls = class_of(bytes);
+        auto &cache = local().lists[cls];
+        auto *b = static_cast<Block *>(p);
+        b->next = cache.head;
+        cache.head = b;
+        if (++cache.count >= 2 * kBatch) release(cls, cache, kBatch);
+    }
+
+    // 向全局堆申请过的 slab 总字节数（只增不减），用来确认热路径已经不再碰全局堆
+    std::size_t slab_bytes() const {
+        std::size_t n = 0;
+        for (auto &c : central_) {
+            std::lock_guard<std::mutex> lock(c.mtx);
+            n += c.slabs.size() * kSlabBytes;
+        }
+        return n;
+    }
+
+    static constexpr bool pooled(std::size_t bytes, std::size_t align) noexcept {
+        return bytes <= kMaxBlock && align <= kMaxAlign;
+    }
+
+    static constexpr std::size_t block_size(std::size_t cls) noexcept { return kMinBlock << cls; }
+
+private:
+    struct Block {
+        Block *next;
+    };
+
+    struct FreeList {
+        Block *head = nullptr;
+        std::size_t count = 0;
+    };
+
+    struct Central {
+        mutable std::mutex mtx;
+        FreeList free;
+        std::vector<void *> slabs;
+    };
+
+    // 线程退出时把本地缓存整体还给中心链表
+    struct ThreadCache {
+        FreeList lists[kClasses];
+        ~ThreadCache() {
+            auto &pool = instance();
+            for (std::size_t cls = 0; cls < kClasses; ++cls) {
+                pool.release(cls, lists[cls], lists[cls].count);
+            }
+        }
+    };
+
+    SlabPool() = default;
+
+    static std::size_t class_of(std::size_t bytes) noexcept {
+        std::size_t cls = 0;
+        while ((kMinBlock << cls) < bytes) ++cls;
+        return cls;
+    }
+
+    static ThreadCache &local() noexcept {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    // 本地链表空了：从中心链表拿一批，不够就先切一块新 slab
+    void refill(std::size_t cls, FreeList &cache) {
+        auto &c = central_[cls];
+        std::lock_guard<std::mutex> lock(c.mtx);
+        if (!c.free.head) carve(cls, c);
+        while (c.free.head && cache.count < kBatch) {
+            Block *b = c.free.head;
+            c.free.head = b->next;
+            --c.free.count;
+            b->next = cache.head;
+            cache.head = b;
+            ++cache.count;
+        }
+    }
+
+    // 把本地链表头部 n 个块还给中心链表：先在锁外摘成一段，再一次性接上
+    void release(std::size_t cls, FreeList &cache, std::size_t n) noexcept {
+        if (n == 0 || !cache.head) return;
+        Block *first = cache.head;
+        Block *last = first;
+        std::size_t moved = 1;
+        while (moved < n && last->next) {
+            last = last->next;
+            ++moved;
+        }
+        cache.head = last->next;
+        cache.count -= moved;
+
+        auto &c = central_[cls];
+        std::lock_guard<std::mutex> lock(c.mtx);
+        last->next = c.free.head;
+        c.free.head = first;
+        c.free.count += moved;
+    }
+
+    // 调用方持有 c.mtx
+    void carve(std::size_t cls, Central &c) {
+        auto *slab = static_cast<unsigned char *>(::operator new(kSlabBytes));
+        c.slabs.push_back(slab);
+        auto size = block_size(cls);
+        for (std::size_t off = 0; off + size <= kSlabBytes; off += size) {
+            auto *b = reinterpret_cast<Block *>(slab + off);
+            b->next = c.free.head;
+            c.free.head = b;
+            ++c.free.count;
+        }
+    }
+
+    Central central_[kClasses];
+};
+
+// 标准分配器接口：无状态，所有实例都从同一个 SlabPool 取内存
+template <class T>
+class pool_allocator {
+public:
+    using value_type = T;
+
+    pool_allocator() noexcept = default;
+    template <class U>
+    pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    T *allocate(std::size_t n) {
+        if (n > static_cast<std::size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T *>(SlabPool::instance().allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        SlabPool::instance().deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    template <class U>
+    bool operator==(const pool_allocator<U>&) const noexcept { return true; }
+    template <class U>
+    bool operator!=(const pool_allocator<U>&) const noexcept { return false; }
+};
+
+// 单个对象：替代 new T(args...) / delete p
+template <class T, class... Args>
+T *pool_new(Args&&... args) {
+    void *mem = SlabPool::instance().allocate(sizeof(T), alignof(T));
+    try {
+        return ::new (mem) T(std::forward<Args>(args)...);
+    } catch (...) {
+        SlabPool::instance().deallocate(mem, sizeof(T), alignof(T));
+        throw;
+    }
+}
+
+template <class T>
+void pool_delete(T *p) noexcept {
+    if (!p) return;
+    p->~T();
+    SlabPool::instance().deallocate(p, sizeof(T), alignof(T));
+}
+
+} // namespace day3
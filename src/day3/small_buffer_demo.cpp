@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "small_buffer.hpp"
+
+// 统计全局堆分配次数：替换全局 operator new/delete（仅本示例）
+static std::atomic<long> g_allocs{0};
+
+void *operator new(std::size_t n) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+// training/test0.cpp 的 Buffer_cps_r5：copy-and-swap，每次拷贝赋值都分配
+struct Buffer_cps_r5 {
+    int *data;
+    std::size_t size;
+    explicit Buffer_cps_r5(std::size_t n) : data(n ? new int[n]() : nullptr), size(n) {}
+    ~Buffer_cps_r5() { delete[] data; }
+    Buffer_cps_r5(const Buffer_cps_r5 &o) : data(o.size ? new int[o.size] : nullptr), size(o.size) {
+        std::copy(o.data, o.data + size, data);
+    }
+    Buffer_cps_r5(Buffer_cps_r5 &&o) noexcept : data(o.data), size(o.size) {
+        o.data = nullptr;
+        o.size = 0;
+    }
+    Buffer_cps_r5 &operator=(Buffer_cps_r5 o) noexcept {
+        std::swap(data, o.data);
+        std::swap(size, o.size);
+        return *this;
+    }
+};
+
+using Clock = std::chrono::steady_clock;
+static std::atomic<long> sink{0};
+
+// 每轮：构造一个 n 元素缓冲区、拷贝构造一个、再拷贝赋值给一个长期存在的缓冲区
+template <class Buf>
+static void bench(const char *name, std::size_t n, long rounds) {
+    Buf keep(n);
+    long before = g_allocs.load();
+    auto t0 = Clock::now();
+    for (long i = 0; i < rounds; ++i) {
+        Buf a(n);
+        if (n) a.data()[0] = static_cast<int>(i);
+        Buf b(a);
+        keep = b;
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / rounds;
+    sink += n ? keep.data()[0] : 0;
+    std::cout << "  " << name << " n=" << n << ": " << ns << " ns/round, "
+              << static_cast<double>(g_allocs.load() - before) / rounds << " allocs/round\n";
+}
+
+// Buffer_cps_r5 没有 data() 成员函数，包一层让 bench 统一调用
+struct CpsAdapter : Buffer_cps_r5 {
+    using Buffer_cps_r5::Buffer_cps_r5;
+    int *data() { return Buffer_cps_r5::data; }
+};
+
+int main() {
+    const long rounds = 1000000;
+    // n=0 时 SmallBuffer 更慢（内联/堆的判断和自指针的维护），n=64 溢出到堆上时只省下赋值那一次分配；
+    // 收益集中在 n <= 16 的内联区间，见 small_buffer.hpp 的“代价”
+    std::cout << "== 小尺寸：copy-and-swap Buffer vs SmallBuffer<int, 16> ==\n";
+    for (std::size_t n : {0u, 4u, 16u, 64u}) {
+        bench<CpsAdapter>("Buffer_cps_r5  ", n, rounds);
+        bench<day3::SmallBuffer<int, 16>>("SmallBuffer<16>", n, rounds);
+    }
+
+    std::cout << "\n== 赋值复用容量 ==\n";
+    day3::SmallBuffer<std::string, 4> big(100, "x");
+    const void *storage = big.data();
+    day3::SmallBuffer<std::string, 4> other(50, "y");
+    big = other;
+    std::cout << "assign 50 into capacity " << big.capacity() << ": storage "
+              << (big.data() == storage ? "reused" : "reallocated") << ", inline=" << big.is_inline() << "\n";
+
+    day3::SmallBuffer<std::string, 4> small{"a", "b"};
+    day3::SmallBuffer<std::string, 4> moved(std::move(small));
+    std::cout << "moved inline buffer: size " << moved.size() << ", inline=" << moved.is_inline()
+              << ", source size " << small.size() << "\n";
+
+    std::vector<day3::SmallBuffer<int, 8>> vec;
+    for (int i = 0; i < 100; ++i) vec.emplace_back(static_cast<std::size_t>(i % 12));
+    std::cout << "noexcept move: "
+              << std::is_nothrow_move_constructible_v<day3::SmallBuffer<int, 8>> << "\n";
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "blocking_queue.hpp"
+
+// producers 个线程各推 per_producer 个数，consumers 个线程逐个 pop 或 pop_bulk 取完并求和校验；
+// 生产者全部结束后 close()，消费者靠 pop 返回 nullopt / pop_bulk 返回 0 退出
+using Clock = std::chrono::steady_clock;
+
+static void run(int producers, int consumers, long per_producer, std::size_t batch) {
+    day8::BlockingQueue<long> q(256);
+    const long n = producers * per_producer;
+    std::atomic<long> sum{0};
+    auto t0 = Clock::now();
+
+    std::vector<std::thread> cons;
+    for (int c = 0; c < consumers; ++c) {
+        cons.emplace_back([&]{
+            long local = 0;
+            if (batch == 1) {
+                while (auto v = q.pop()) local += *v;
+            } else {
+                std::vector<long> buf;
+                buf.reserve(batch);
+                while (q.pop_bulk(std::back_inserter(buf), batch) > 0) {
+                    for (long v : buf) local += v;
+                    buf.clear();
+                }
+            }
+            sum += local;
+        });
+    }
+    std::vector<std::thread> prods;
+    for (int p = 0; p < producers; ++p) {
+        prods.emplace_back([&, p]{
+            for (long i = 0; i < per_producer; ++i) q.push(p * per_producer + i);
+        });
+    }
+    for (auto &t : prods) t.join();
+    q.close();
+    for (auto &t : cons) t.join();
+
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    std::cout << producers << "P/" << consumers << "C "
+              << (batch == 1 ? "pop         " : "pop_bulk(" + std::to_string(batch) + ")")
+              << ": " << (sum.load() == n * (n - 1) / 2 ? "ok" : "WRONG SUM")
+              << ", " << static_cast<long>(n / secs / 1e3) << " Kops/s\n";
+}
+
+int main() {
+    const long n = 500000;
+    for (int threads : {1, 4}) {
+        run(threads, threads, n / threads, 1);
+        run(threads, threads, n / threads, 64);
+    }
+
+    std::cout << "\n== drain_to ==\n";
+    day8::BlockingQueue<std::string> q(8);
+    for (int i = 0; i < 5; ++i) q.push("job" + std::to_string(i));
+    std::vector<std::string> out;
+    std::cout << "drained " << q.drain_to(out) << ", left " << q.size() << ":";
+    for (auto &s : out) std::cout << " " << s;
+    std::cout << "\n";
+
+    std::cout << "\n== close + move-only payload ==\n";
+    day8::BlockingQueue<std::unique_ptr<int>> jobs(2);
+    std::thread worker([&]{
+        while (auto job = jobs.pop()) std::cout << "worker got " << **job << "\n";
+        std::cout << "worker: queue closed\n";
+    });
+    for (int i = 1; i <= 3; ++i) jobs.push(std::make_unique<int>(i * 10));
+    jobs.close();
+    auto late = std::make_unique<int>(99);
+    bool accepted = jobs.push(std::move(late));
+    worker.join();
+    std::cout << "push after close: " << (accepted ? "accepted" : "rejected")
+              << ", payload kept=" << (late ? *late : -1) << "\n";
+    return 0;
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+// BlockingQueue：可关闭的有界阻塞队列（mutex + 两个条件变量），取代 test3/test5/test6 里的全局队列和计数
+// 典型用法：
+//   day8::BlockingQueue<std::unique_ptr<Job>> q(64);   // 元素可以是只能移动的类型
+//   // 生产者
+//   if (!q.push(std::move(job))) { ...队列已关闭，job 仍在调用方手里... }
+//   q.close();                                         // 所有生产者结束后由协调方调用一次
+//   // 消费者
+//   while (auto job = q.pop()) { run(**job); }         // 关闭且取空后返回 nullopt
+//   std::vector<std::unique_ptr<Job>> batch;
+//   q.pop_bulk(std::back_inserter(batch), 32);         // 至少等到 1 个，一次最多取 32 个；返回 0 表示结束
+//   q.drain_to(batch);                                 // 不等待，把当前所有元素一次取走
+//
+// 设计要点：
+// - 结束用 close() 显式表达：不再需要 producer_left / finished 之类的全局计数，也不需要哨兵值
+// - 生产者/消费者等待前先登记人数，只有确实有人在等时才 notify，且只叫醒需要的个数；
+//   同时记下“已叫醒但还没醒来处理”的个数，对已经叫过的等待者不再重复 notify。
+//   否则单生产者单消费者时，消费者被叫醒到真正运行之间，生产者每 push 一次都是一次 futex 系统调用
+// - close() 只叫醒一个等待者，它发现队列已关闭退出时再叫醒下一个（接力），
+//   结束时不会出现所有消费者同时抢锁的惊群
+// - pop_bulk / drain_to 一次临界区取走一批，加锁次数与批数而不是元素数成正比；
+//   一批腾出多个位置时用一次 notify_all 叫醒卡在容量上的生产者
+// - pop_bulk 省的是锁和唤醒，不是每个元素的搬运：多个消费者争一把锁、或每个元素的处理很轻
+//   （锁开销占大头）时明显更快；单生产者单消费者时锁基本无争用，消费者一批取空后更常睡下，
+//   与逐个 pop 持平甚至略慢（见 blocking_demo 的 1P/1C 一行），这时没必要换成 pop_bulk
+// - push 接收右值引用，失败（已关闭）时不会移走参数，只能移动的元素不会丢
+
+namespace day8 {
+
+template <class T>
+class BlockingQueue {
+public:
+    explicit BlockingQueue(std::size_t cap) : cap_(cap ? cap : 1) {}
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    // 满了就等；已关闭返回 false，v 保持原样
+    bool push(T &&v) { return emplace_impl(std::move(v)); }
+    bool push(const T &v) { return emplace_impl(v); }
+
+    // 关闭后不再接受 push；已入队的元素仍可被取走。重复调用无副作用
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (closed_) return;
+            closed_ = true;
+        }
+        // 各叫醒一个，其余的由被叫醒者接力
+        not_empty_.notify_one();
+        not_full_.notify_one();
+    }
+
+    bool closed() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return closed_;
+    }
+
+    // 关闭且取空后返回 nullopt
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (!wait_not_empty(lock)) return std::nullopt;
+        std::optional<T> out(std::move(q_.front()));
+        q_.pop_front();
+        after_take(lock, 1);
+        return out;
+    }
+
+    // 同上，取到时移动赋值给 out；关闭且取空后返回 false
+    bool pop(T &out) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (!wait_not_empty(lock)) return false;
+        out = std::move(q_.front());
+        q_.pop_front();
+        after_take(lock, 1);
+        return true;
+    }
+
+    // 等到至少有 1 个元素，然后在同一临界区里最多取 max_n 个写到 out；
+    // 返回取到的个数，0 表示队列已关闭且取空
+    template <class OutputIt>
+    std::size_t pop_bulk(OutputIt out, std::size_t max_n) {
+        if (max_n == 0) return 0;
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (!wait_not_empty(lock)) return 0;
+        auto n = take(out, max_n);
+        after_take(lock, n);
+        return n;
+    }
+
+    // 不等待：把当前所有元素追加到 c 的末尾；返回取到的个数
+    template <class Container>
+    std::size_t drain_to(Container &c) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        auto n = take(std::back_inserter(c), q_.size());
+        after_take(lock, n);
+        return n;
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return q_.size();
+    }
+
+    std::size_t capacity() const noexcept { return cap_; }
+
+private:
+    template <class U>
+    bool emplace_impl(U &&v) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (!closed_ && q_.size() >= cap_) {
+            wait(not_full_, lock, full_, [this]{ return closed_ || q_.size() < cap_; });
+        }
+        if (closed_) {
+            // 接力：叫醒下一个还卡在容量上的生产者，让它也看到关闭
+            bool more = full_.claim(1) > 0;
+            lock.unlock();
+            if (more) not_full_.notify_one();
+            return false;
+        }
+        q_.push_back(std::forward<U>(v));
+        bool wake = empty_.claim(1) > 0;
+        lock.unlock();
+        if (wake) not_empty_.notify_one();
+        return true;
+    }
+
+    // 调用方持有 mtx_；返回 false 表示已关闭且没有元素可取（此时已完成接力唤醒并解锁）
+    bool wait_not_empty(std::unique_lock<std::mutex> &lock) {
+        if (q_.empty() && !closed_) {
+            wait(not_empty_, lock, empty_, [this]{ return closed_ || !q_.empty(); });
+        }
+        if (!q_.empty()) return true;
+        bool more = empty_.claim(1) > 0;
+        lock.unlock();
+        if (more) not_empty_.notify_one();
+        return false;
+    }
+
+    // 调用方持有 mtx_
+    template <class OutputIt>
+    std::size_t take(OutputIt out, std::size_t max_n) {
+        std::size_t n = q_.size() < max_n ? q_.size() : max_n;
+        auto last = q_.begin() + static_cast<std::ptrdiff_t>(n);
+        std::move(q_.begin(), last, out);
+        q_.erase(q_.begin(), last);
+        return n;
+    }
+
+    // 取走了 n 个并解锁：
+    // - 腾出的位置只叫醒需要的生产者个数，能放下多个时统一 notify_all 一次
+    // - 队列还有剩余（或已关闭需要接力）且仍有消费者在等，再叫醒一个
+    void after_take(std::unique_lock<std::mutex> &lock, std::size_t n) {
+        auto producers = full_.claim(n);
+        bool more = (closed_ || !q_.empty()) && empty_.claim(1) > 0;
+        lock.unlock();
+        if (more) not_empty_.notify_one();
+        if (producers > 1) not_full_.notify_all();
+        else if (producers == 1) not_full_.notify_one();
+    }
+
+    // 一侧等待者的计数，受 mtx_ 保护
+    struct Waiters {
+        std::size_t waiting = 0;     // 登记在这个条件变量上的线程数
+        std::size_t signalled = 0;   // 已 notify、对方还没醒来处理的次数
+
+        // 最多再叫醒 k 个还没被叫过的等待者，返回需要 notify 的个数
+        std::size_t claim(std::size_t k) noexcept {
+            std::size_t idle = waiting - signalled;
+            if (k > idle) k = idle;
+            signalled += k;
+            return k;
+        }
+    };
+
+    // 手写等待循环而不用带谓词的 wait：每次醒来都要消掉一次 signalled，
+    // 否则被叫醒却发现条件又不成立（被别人抢先）的线程会让后续 notify 一直被压住
+    template <class Ready>
+    static void wait(std::condition_variable &cv, std::unique_lock<std::mutex> &lock,
+                     Waiters &w, Ready ready) {
+        ++w.waiting;
+        do {
+            cv.wait(lock);
+            if (w.signalled > 0) --w.signalled;
+        } while (!ready());
+        --w.waiting;
+        if (w.signalled > w.waiting) w.signalled = w.waiting;
+    }
+
+    const std::size_t cap_;
+    std::deque<T> q_;
+    mutable std::mutex mtx_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    bool closed_ = false;
+    Waiters full_;                    // 卡在容量上的生产者
+    Waiters empty_;                   // 卡在空队列上的消费者
+};
+
+} // namespace day8
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+// EventCount：给无锁结构配的“等待/唤醒”原语
+// 典型用法（以“等队列非空”为例）：
+//   while (!q.try_pop(v)) {
+//       auto key = not_empty.prepare_wait();
+//       if (q.try_pop(v)) { not_empty.cancel_wait(); break; }
+//       not_empty.wait(key);
+//   }
+//   // 另一侧：q.try_push(x); not_empty.notify_one();
+//
+// 设计要点：
+// - 快路径（没人在等）时 notify 只是一次原子读，不进内核
+// - 只有真的要睡时才调用 futex（Linux）；其它平台退化为 mutex + condition_variable
+// - prepare_wait 之后必须再检查一次条件，否则会丢唤醒：
+//   等待方“登记 -> 复查”，通知方“修改 -> 检查登记”，两边都有 seq_cst 栅栏
+
+namespace day8 {
+
+class EventCount {
+public:
+    EventCount() = default;
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    std::uint32_t prepare_wait() noexcept {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_acquire);
+    }
+
+    void cancel_wait() noexcept {
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // key 为 prepare_wait 的返回值；期间若有 notify，立即返回
+    void wait(std::uint32_t key) noexcept {
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            sleep(key);
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void notify_one() noexcept { notify(1); }
+    void notify_all() noexcept { notify(INT_MAX); }
+
+private:
+    void notify(int n) noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) return; // 快路径：没人睡
+        epoch_.fetch_add(1, std::memory_order_acq_rel);
+        wake(n);
+    }
+
+#ifdef __linux__
+    void sleep(std::uint32_t key) noexcept {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&epoch_),
+                FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+    }
+
+    void wake(int n) noexcept {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&epoch_),
+                FUTEX_WAKE_PRIVATE, n, nullptr, nullptr, 0);
+    }
+#else
+    void sleep(std::uint32_t key) noexcept {
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [&]{ return epoch_.load(std::memory_order_acquire) != key; });
+    }
+
+    void wake(int n) noexcept {
+        { std::lock_guard<std::mutex> lock(mtx_); }
+        if (n == 1) cv_.notify_one(); else cv_.notify_all();
+    }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+#endif
+
+    std::atomic<std::uint32_t> epoch_{0};
+    std::atomic<std::uint32_t> waiters_{0};
+
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                  "futex 需要 atomic<uint32_t> 与 uint32_t 同布局");
+};
+
+} // namespace day8
@@ -0,0 +1,65 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mpmc_queue.hpp"
+#include "mutex_queue.hpp"
+
+// producers 个线程各推 per_producer 个数，consumers 个线程一起取完；用 -1 作为每个消费者的结束标记
+template <class Queue>
+void run(const std::string &name, Queue &q, int producers, int consumers, long per_producer) {
+    using Clock = std::chrono::steady_clock;
+    std::atomic<long> sum{0};
+    auto t0 = Clock::now();
+
+    std::vector<std::thread> threads;
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]{
+            long local = 0, v;
+            while (true) {
+                q.pop(v);
+                if (v < 0) break;
+                local += v;
+            }
+            sum += local;
+        });
+    }
+    std::vector<std::thread> prods;
+    for (int p = 0; p < producers; ++p) {
+        prods.emplace_back([&, p]{
+            for (long i = 0; i < per_producer; ++i) q.push(p * per_producer + i);
+        });
+    }
+    for (auto &t : prods) t.join();
+    for (int c = 0; c < consumers; ++c) q.push(-1);
+    for (auto &t : threads) t.join();
+
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    long n = producers * per_producer;
+    long expect = n * (n - 1) / 2;
+    std::cout << name << " " << producers << "P/" << consumers << "C: "
+              << (sum.load() == expect ? "ok" : "WRONG SUM")
+              << ", " << static_cast<long>(n / secs / 1e3) << " Kops/s\n";
+}
+
+int main() {
+    const long n = 200000;
+    for (int threads : {1, 2, 4}) {
+        day8::MPMCQueue<long> lock_free(1024);
+        day8::MutexQueue<long> locked(1024);
+        run("mpmc ", lock_free, threads, threads, n);
+        run("mutex", locked, threads, threads, n);
+    }
+
+    std::cout << "\n== try_push / try_pop ==\n";
+    day8::MPMCQueue<std::string> q(4);
+    int pushed = 0;
+    while (q.try_push("item" + std::to_string(pushed))) ++pushed;
+    std::cout << "capacity=" << q.capacity() << " pushed until full=" << pushed << "\n";
+    std::string s;
+    while (q.try_pop(s)) std::cout << "pop " << s << "\n";
+    return 0;
+}
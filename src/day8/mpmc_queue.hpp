@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "event_count.hpp"
+
+// MPMCQueue：有界多生产者多消费者无锁环形队列（Dmitry Vyukov 的序号槽算法）
+// 典型用法：
+//   day8::MPMCQueue<int> q(1024);      // 容量向上取整到 2 的幂
+//   q.try_push(1);                     // 满了返回 false，从不阻塞
+//   int v;
+//   if (q.try_pop(v)) { ... }          // 空了返回 false
+//   q.push(2); q.pop(v);               // 阻塞版本：只有真满/真空时才进 futex
+//
+// 设计要点：
+// - 每个槽带一个序号 seq：seq == pos 表示可写，seq == pos + 1 表示可读，
+//   生产者/消费者各自只在 tail_/head_ 上 CAS 抢位置，不需要锁
+// - head_、tail_ 各占一条 cache line，生产者和消费者互不伪共享
+// - 元素在抢到槽之后才构造，所以要求 T 的移动构造 noexcept（拷贝入队先在外面拷好再移动进去）；
+//   出队在抢到槽之后才移动赋值给 out，同样要求 noexcept，否则异常会跳过 seq 的发布，
+//   这个槽永远不会还给生产者
+// - 阻塞版本在 try_* 失败后才登记到 EventCount；没人等待时 notify 只是一次原子读
+
+namespace day8 {
+
+inline constexpr std::size_t kCacheLine = 64;
+
+template <class T>
+class MPMCQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "MPMCQueue<T> 要求 T 的移动构造为 noexcept");
+    static_assert(std::is_nothrow_move_assignable_v<T>,
+                  "MPMCQueue<T> 要求 T 的移动赋值为 noexcept");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    explicit MPMCQueue(size_type capacity)
+        : mask_(round_up_pow2(capacity < 2 ? 2 : capacity) - 1),
+          cells_(new Cell[mask_ + 1]) {
+        for (size_type i = 0; i <= mask_; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // 析构时已无并发访问，直接原地销毁剩余元素
+    ~MPMCQueue() {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        for (auto pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            cells_[pos & mask_].ptr()->~T();
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+
+    // 近似大小：并发修改时只是一个快照
+    [[nodiscard]] size_type size_approx() const noexcept {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto head = head_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool try_push(T&& v) noexcept {
+        if (!try_emplace_impl(std::move(v))) return false;
+        not_empty_.notify_one();
+        return true;
+    }
+
+    bool try_push(const T& v) {
+        T tmp(v);
+        return try_push(std::move(tmp));
+    }
+
+    bool try_pop(T& out) noexcept {
+        if (!try_pop_impl(out)) return false;
+        not_full_.notify_one();
+        return true;
+    }
+
+    // 阻塞入队：队列满时先短暂让出 CPU，仍然满才睡在 not_full_ 上
+    void push(T v) {
+        bool done = try_emplace_impl(std::move(v));
+        for (int i = 0; !done && i < kYieldBeforeSleep; ++i) {
+            std::this_thread::yield();
+            done = try_emplace_impl(std::move(v));
+        }
+        while (!done) {
+            auto key = not_full_.prepare_wait();
+            if (try_emplace_impl(std::move(v))) {
+                not_full_.cancel_wait();
+                break;
+            }
+            not_full_.wait(key);
+            done = try_emplace_impl(std::move(v));
+        }
+        not_empty_.notify_one();
+    }
+
+    // 阻塞出队：队列空时先短暂让出 CPU，仍然空才睡在 not_empty_ 上
+    void pop(T& out) {
+        bool done = try_pop_impl(out);
+        for (int i = 0; !done && i < kYieldBeforeSleep; ++i) {
+            std::this_thread::yield();
+            done = try_pop_impl(out);
+        }
+        while (!done) {
+            auto key = not_empty_.prepare_wait();
+            if (try_pop_impl(out)) {
+                not_empty_.cancel_wait();
+                break;
+            }
+            not_empty_.wait(key);
+            done = try_pop_impl(out);
+        }
+        not_full_.notify_one();
+    }
+
+private:
+    // 对端通常很快就能腾出位置/放入元素，先 yield 几次，避免每个元素都走一次 futex 睡眠/唤醒
+    static constexpr int kYieldBeforeSleep = 16;
+
+    struct Cell {
+        std::atomic<size_type> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *ptr() noexcept { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+
+    static size_type round_up_pow2(size_type n) noexcept {
+        size_type p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    // 失败时 v 保持原样（只有抢到槽才会移动）
+    bool try_emplace_impl(T&& v) noexcept {
+        Cell *cell;
+        size_type pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_type seq = cell->seq.load(std::memory_order_acquire);
+            auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (dif == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                return false; // 满：这个槽上一轮的元素还没被取走
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        ::new (static_cast<void *>(cell->storage)) T(std::move(v));
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop_impl(T& out) noexcept {
+        Cell *cell;
+        size_type pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_type seq = cell->seq.load(std::memory_order_acquire);
+            auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (dif == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                return false; // 空
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        T *p = cell->ptr();
+        out = std::move(*p);
+        p->~T();
+        cell->seq.store(pos + mask_ + 1, std::memory_order_release); // 留给下一轮的生产者
+        return true;
+    }
+
+    const size_type mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(kCacheLine) std::atomic<size_type> tail_{0};
+    alignas(kCacheLine) std::atomic<size_type> head_{0};
+    alignas(kCacheLine) EventCount not_empty_;
+    EventCount not_full_;
+};
+
+} // namespace day8
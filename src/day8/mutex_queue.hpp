@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <queue>
+#include <utility>
+
+// MutexQueue：training/test6.cpp 的有界队列（mutex + 两个条件变量）整理成类，
+// 每个元素都要加一次锁、notify 一次，作为无锁队列基准的对照组
+
+namespace day8 {
+
+template <class T>
+class MutexQueue {
+public:
+    explicit MutexQueue(std::size_t cap) : cap_(cap) {}
+
+    void push(T v) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        not_full_.wait(lock, [this]{ return q_.size() < cap_; });
+        q_.push(std::move(v));
+        lock.unlock();
+        not_empty_.notify_one();
+    }
+
+    void pop(T &v) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        not_empty_.wait(lock, [this]{ return !q_.empty(); });
+        v = std::move(q_.front());
+        q_.pop();
+        lock.unlock();
+        not_full_.notify_one();
+    }
+
+private:
+    std::size_t cap_;
+    std::queue<T> q_;
+    std::mutex mtx_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+};
+
+} // namespace day8
@@ -0,0 +1,49 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "${BASH_SOURCE[0]%/*}" && pwd)"
+BUILD_DIR="${SCRIPT_DIR}/../build/day8"
+SRC_DIR="${SCRIPT_DIR}"
+
+usage() {
+  cat <<'EOF'
+用法: ./run.sh [mpmc|spsc|bulk|all]
+  mpmc  编译运行无锁 MPMC 环形队列示例（对比 mutex + 条件变量队列）
+  spsc  编译运行 SPSC 环形队列吞吐测试（逐个 / push_n,pop_n 批量 / mutex 队列）
+  bulk  编译运行阻塞队列示例（逐个 pop 对比 pop_bulk、drain_to、close + 只能移动的元素）
+  all   编译运行全部示例（默认）
+EOF
+}
+
+build() {
+  mkdir -p "${BUILD_DIR}"
+  local target="$1" src="$2"; shift 2
+  echo "[BUILD] ${src} -> ${target}"
+  g++ -std=c++17 -O0 -g -Wall -Wextra -pedantic -pthread "$@" \
+      "${SRC_DIR}/${src}" -o "${BUILD_DIR}/${target}"
+}
+
+run_mpmc() {
+  build "mpmc_queue" "main.cpp" -O2
+  echo "[RUN ] mpmc_queue" && "${BUILD_DIR}/mpmc_queue"
+}
+
+run_spsc() {
+  build "spsc_bench" "spsc_bench.cpp" -O2
+  echo "[RUN ] spsc_bench" && "${BUILD_DIR}/spsc_bench"
+}
+
+run_bulk() {
+  build "blocking_queue" "blocking_demo.cpp" -O2
+  echo "[RUN ] blocking_queue" && "${BUILD_DIR}/blocking_queue"
+}
+
+choice=${1:-all}
+case "${choice}" in
+  mpmc) run_mpmc ;;
+  spsc) run_spsc ;;
+  bulk) run_bulk ;;
+  all)  run_mpmc; run_spsc; run_bulk ;;
+  -h|--help) usage ;;
+  *) usage; exit 1 ;;
+esac
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mutex_queue.hpp"
+#include "spsc_queue.hpp"
+
+// 1 生产者 + 1 消费者，推 n 个数，消费者求和校验；对比三种写法的吞吐
+using Clock = std::chrono::steady_clock;
+
+static void report(const std::string &name, long n, long sum, Clock::time_point t0) {
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    long expect = n * (n - 1) / 2;
+    std::cout << name << ": " << (sum == expect ? "ok" : "WRONG SUM")
+              << ", " << static_cast<long>(n / secs / 1e6) << " Mops/s\n";
+}
+
+// 满/空时让出 CPU：单核机器上不让出的话对端根本跑不起来
+static void bench_spsc_single(long n) {
+    day8::SPSCQueue<long> q(1024);
+    long sum = 0;
+    auto t0 = Clock::now();
+    std::thread consumer([&]{
+        long v;
+        for (long got = 0; got < n;) {
+            if (q.try_pop(v)) { sum += v; ++got; }
+            else std::this_thread::yield();
+        }
+    });
+    for (long i = 0; i < n; ++i) {
+        while (!q.try_push(i)) std::this_thread::yield();
+    }
+    consumer.join();
+    report("spsc  try_push/try_pop", n, sum, t0);
+}
+
+static void bench_spsc_batch(long n, std::size_t batch) {
+    day8::SPSCQueue<long> q(1024);
+    long sum = 0;
+    auto t0 = Clock::now();
+    std::thread consumer([&]{
+        std::vector<long> buf(batch);
+        for (long got = 0; got < n;) {
+            auto k = q.pop_n(buf.begin(), batch);
+            if (k == 0) { std::this_thread::yield(); continue; }
+            for (std::size_t i = 0; i < k; ++i) sum += buf[i];
+            got += static_cast<long>(k);
+        }
+    });
+    std::vector<long> buf(batch);
+    for (long i = 0; i < n;) {
+        std::size_t k = 0;
+        for (; k < batch && i + static_cast<long>(k) < n; ++k) buf[k] = i + static_cast<long>(k);
+        std::size_t sent = 0;
+        while (sent < k) {
+            auto m = q.push_n(buf.begin() + static_cast<std::ptrdiff_t>(sent), k - sent);
+            if (m == 0) std::this_thread::yield();
+            sent += m;
+        }
+        i += static_cast<long>(k);
+    }
+    consumer.join();
+    report("spsc  push_n/pop_n(" + std::to_string(batch) + ")", n, sum, t0);
+}
+
+static void bench_mutex(long n) {
+    day8::MutexQueue<long> q(1024);
+    long sum = 0;
+    auto t0 = Clock::now();
+    std::thread consumer([&]{
+        long v;
+        for (long got = 0; got < n; ++got) {
+            q.pop(v);
+            sum += v;
+        }
+    });
+    for (long i = 0; i < n; ++i) q.push(i);
+    consumer.join();
+    report("mutex push/pop        ", n, sum, t0);
+}
+
+int main() {
+    const long n = 2000000;
+    bench_mutex(n);
+    bench_spsc_single(n);
+    bench_spsc_batch(n, 64);
+    bench_spsc_batch(n, 256);
+    return 0;
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mpmc_queue.hpp" // kCacheLine
+
+// SPSCQueue：单生产者单消费者的 wait-free 环形队列
+// 典型用法（生产者、消费者各自只在一个线程里调用）：
+//   day8::SPSCQueue<int> q(1024);
+//   // 生产者线程
+//   q.try_push(42);
+//   q.push_n(batch.data(), batch.size());   // 一次发布一批，返回实际放入个数
+//   // 消费者线程
+//   int v; q.try_pop(v);
+//   q.pop_n(out, 64);                        // 一次取走一批
+//
+// 设计要点：
+// - 只有一个线程写 tail_、一个线程写 head_，不需要 CAS，每个操作步数有上界（wait-free）
+// - 生产者缓存一份 head_（cached_head_），只有看起来满了才去读对方的 cache line；消费者同理
+// - push_n/pop_n 先批量搬运元素，最后只做一次 release 发布，摊薄原子操作和 cache line 往返
+// - 不带阻塞版本：单生产单消费的流水线一般自己 spin/yield 或配合上层的批处理节奏
+
+namespace day8 {
+
+template <class T>
+class SPSCQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "SPSCQueue<T> 要求 T 的移动构造为 noexcept");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    explicit SPSCQueue(size_type capacity)
+        : mask_(round_up_pow2(capacity < 2 ? 2 : capacity) - 1),
+          slots_(static_cast<Slot *>(::operator new[]((mask_ + 1) * sizeof(Slot),
+                                                      std::align_val_t{alignof(Slot)}))) {}
+
+    ~SPSCQueue() {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        for (auto pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            at(pos)->~T();
+        }
+        ::operator delete[](slots_, std::align_val_t{alignof(Slot)});
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+
+    [[nodiscard]] size_type size_approx() const noexcept {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    // ---- 生产者端 ----
+
+    template <class... Args>
+    bool try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ > mask_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ > mask_) return false;
+        }
+        ::new (static_cast<void *>(at(tail))) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(T&& v) noexcept { return try_emplace(std::move(v)); }
+    bool try_push(const T& v) { return try_emplace(v); }
+
+    // 从 first 起最多移动 n 个元素入队，只发布一次；返回实际入队个数
+    template <class InputIt>
+    size_type push_n(InputIt first, size_type n) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        size_type room = capacity() - (tail - cached_head_);
+        if (room < n) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            room = capacity() - (tail - cached_head_);
+        }
+        n = std::min(n, room);
+        for (size_type i = 0; i < n; ++i, ++first) {
+            ::new (static_cast<void *>(at(tail + i))) T(std::move(*first));
+        }
+        if (n) tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // ---- 消费者端 ----
+
+    bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        auto head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) return false;
+        }
+        T *p = at(head);
+        out = std::move(*p);
+        p->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 最多取 max_n 个元素写到 out（输出迭代器），只发布一次；返回实际出队个数
+    template <class OutputIt>
+    size_type pop_n(OutputIt out, size_type max_n) {
+        auto head = head_.load(std::memory_order_relaxed);
+        size_type avail = cached_tail_ - head;
+        if (avail < max_n) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            avail = cached_tail_ - head;
+        }
+        size_type n = std::min(max_n, avail);
+        for (size_type i = 0; i < n; ++i, ++out) {
+            T *p = at(head + i);
+            *out = std::move(*p);
+            p->~T();
+        }
+        if (n) head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static size_type round_up_pow2(size_type n) noexcept {
+        size_type p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    T *at(size_type pos) const noexcept {
+        return std::launder(reinterpret_cast<T *>(slots_[pos & mask_].storage));
+    }
+
+    const size_type mask_;
+    Slot *const slots_;
+
+    // 生产者独占的 cache line：自己的 tail_ 和对 head_ 的缓存
+    alignas(kCacheLine) std::atomic<size_type> tail_{0};
+    size_type cached_head_ = 0;
+
+    // 消费者独占的 cache line
+    alignas(kCacheLine) std::atomic<size_type> head_{0};
+    size_type cached_tail_ = 0;
+};
+
+} // namespace day8
@@ -0,0 +1,56 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sharded_counter.hpp"
+
+// training/test2.cpp 的三种累加方式：mutex + int、单个 std::atomic、ShardedCounter
+// threads 个线程各 ++ per_thread 次，校验总数并打印吞吐
+using Clock = std::chrono::steady_clock;
+
+template <class Inc, class Read>
+static void run(const std::string &name, int threads, long per_thread, Inc inc, Read read) {
+    auto t0 = Clock::now();
+    std::vector<std::thread> ts;
+    for (int t = 0; t < threads; ++t) {
+        ts.emplace_back([&]{
+            for (long i = 0; i < per_thread; ++i) inc();
+        });
+    }
+    for (auto &t : ts) t.join();
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    long n = threads * per_thread;
+    std::cout << "  " << name << ": " << (read() == n ? "ok" : "WRONG")
+              << ", " << static_cast<long>(n / secs / 1e6) << " Mops/s\n";
+}
+
+int main() {
+    const long per_thread = 5000000;
+    unsigned hw = std::thread::hardware_concurrency();
+    std::cout << "hardware_concurrency=" << hw << "\n";
+    for (int threads : {1, 2, 4, 8}) {
+        std::cout << threads << " threads:\n";
+
+        std::mutex mtx;
+        long counter = 0;
+        run("mutex   ", threads, per_thread,
+            [&]{ std::lock_guard<std::mutex> lock(mtx); ++counter; },
+            [&]{ return counter; });
+
+        std::atomic<long> counterat{0};
+        run("atomic  ", threads, per_thread,
+            [&]{ counterat++; },
+            [&]{ return counterat.load(); });
+
+        day9::ShardedCounter sharded;
+        run("sharded ", threads, per_thread,
+            [&]{ sharded.inc(); },
+            [&]{ return static_cast<long>(sharded.value()); });
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+// 内存序作为策略参数的计数器 / 标志位
+// 典型用法：
+//   day9::Counter<std::uint64_t> hits;                  // 默认 Relaxed：纯统计，不用来同步
+//   hits.inc();
+//   day9::Flag<day9::AcqRel> ready;                     // 发布/获取：set 之前的写对 test 到 true 的线程可见
+//   data = 42; ready.set();                             // 生产方
+//   if (ready.test()) use(data);                        // 消费方
+//   day9::Counter<int, day9::SeqCst> legacy;            // 与 test1/test2 里默认 ++ 等价
+//
+// 设计要点：
+// - 策略只是三组 std::memory_order 常量（读、写、读改写），编译期选定，没有运行时开销
+// - 统计类路径用 Relaxed（x86 上 RMW 仍是 lock 前缀指令，但 ARM 上省掉 dmb 栅栏）
+// - 需要“写完数据再置标志”这种发布语义时用 AcqRel；只有依赖多个变量之间全局顺序时才需要 SeqCst
+//   （x86 上 SeqCst 的 store 会变成 xchg / mov+mfence，是三者里唯一明显更贵的一项）
+
+namespace day9 {
+
+struct Relaxed {
+    static constexpr std::memory_order load  = std::memory_order_relaxed;
+    static constexpr std::memory_order store = std::memory_order_relaxed;
+    static constexpr std::memory_order rmw   = std::memory_order_relaxed;
+};
+
+struct AcqRel {
+    static constexpr std::memory_order load  = std::memory_order_acquire;
+    static constexpr std::memory_order store = std::memory_order_release;
+    static constexpr std::memory_order rmw   = std::memory_order_acq_rel;
+};
+
+struct SeqCst {
+    static constexpr std::memory_order load  = std::memory_order_seq_cst;
+    static constexpr std::memory_order store = std::memory_order_seq_cst;
+    static constexpr std::memory_order rmw   = std::memory_order_seq_cst;
+};
+
+template <class T, class Order = Relaxed>
+class Counter {
+    static_assert(std::is_integral_v<T>, "Counter<T> 只支持整数类型");
+
+public:
+    using value_type = T;
+    using order      = Order;
+
+    constexpr Counter(T init = 0) noexcept : v_(init) {}
+
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    // 返回增加之前的值
+    T add(T n) noexcept { return v_.fetch_add(n, Order::rmw); }
+    T sub(T n) noexcept { return v_.fetch_sub(n, Order::rmw); }
+    T inc() noexcept { return add(1); }
+    T dec() noexcept { return sub(1); }
+
+    // 与 test1 的 Counter::dec 相同：不减到 0 以下；返回是否真的减了
+    bool dec_clamped() noexcept {
+        T cur = v_.load(std::memory_order_relaxed);
+        while (cur > 0) {
+            if (v_.compare_exchange_weak(cur, cur - 1, Order::rmw, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    T value() const noexcept { return v_.load(Order::load); }
+    void store(T n) noexcept { v_.store(n, Order::store); }
+    T exchange(T n) noexcept { return v_.exchange(n, Order::rmw); }
+    void reset() noexcept { store(0); }
+
+private:
+    std::atomic<T> v_;
+};
+
+template <class Order = AcqRel>
+class Flag {
+public:
+    using order = Order;
+
+    constexpr Flag(bool init = false) noexcept : v_(init) {}
+
+    Flag(const Flag&) = delete;
+    Flag& operator=(const Flag&) = delete;
+
+    void set() noexcept { v_.store(true, Order::store); }
+    void clear() noexcept { v_.store(false, Order::store); }
+    bool test() const noexcept { return v_.load(Order::load); }
+
+    // 返回之前是否已置位（只有第一个调用者拿到 false，可用作“只做一次”）
+    bool test_and_set() noexcept { return v_.exchange(true, Order::rmw); }
+
+private:
+    std::atomic<bool> v_;
+};
+
+} // namespace day9
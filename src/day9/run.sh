@@ -0,0 +1,42 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "${BASH_SOURCE[0]%/*}" && pwd)"
+BUILD_DIR="${SCRIPT_DIR}/../build/day9"
+SRC_DIR="${SCRIPT_DIR}"
+
+usage() {
+  cat <<'EOF'
+用法: ./run.sh [counter|order|all]
+  counter  编译运行分片计数器基准（对比 mutex、单个 std::atomic）
+  order    编译运行内存序策略基准（relaxed / acq_rel / seq_cst）
+  all      编译运行全部示例（默认）
+EOF
+}
+
+build() {
+  mkdir -p "${BUILD_DIR}"
+  local target="$1" src="$2"; shift 2
+  echo "[BUILD] ${src} -> ${target}"
+  g++ -std=c++17 -O0 -g -Wall -Wextra -pedantic -pthread "$@" \
+      "${SRC_DIR}/${src}" -o "${BUILD_DIR}/${target}"
+}
+
+run_counter() {
+  build "counter_bench" "counter_bench.cpp" -O2
+  echo "[RUN ] counter_bench" && "${BUILD_DIR}/counter_bench"
+}
+
+run_order() {
+  build "order_bench" "order_bench.cpp" -O2
+  echo "[RUN ] order_bench" && "${BUILD_DIR}/order_bench"
+}
+
+choice=${1:-all}
+case "${choice}" in
+  counter) run_counter ;;
+  order)   run_order ;;
+  all)     run_counter; run_order ;;
+  -h|--help) usage ;;
+  *) usage; exit 1 ;;
+esac
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// ShardedCounter：分片计数器，替代被很多线程同时 ++ 的单个 std::atomic
+// 典型用法：
+//   day9::ShardedCounter requests;        // 默认按 hardware_concurrency 分片
+//   requests.inc();                       // 热路径：只碰本线程所在分片，relaxed
+//   requests.add(bytes);
+//   auto total = requests.value();        // 读路径：把所有分片加起来
+//
+// 设计要点：
+// - 每个分片独占一条 cache line，不同线程的 ++ 不再在同一条线上来回抢占（ping-pong）
+// - 线程第一次使用时按轮转拿到一个固定分片号（thread_local），之后不再有额外开销；
+//   线程数不超过分片数时每个线程基本独占一个分片
+// - 增加只用 relaxed：计数本身不用来同步其它数据
+// - value() 不是瞬时快照：与并发的 add 交错时读到的是“某个介于前后之间”的值，适合统计/指标
+
+namespace day9 {
+
+inline constexpr std::size_t kCacheLine = 64;
+
+class ShardedCounter {
+public:
+    // shards 为 0 时取 hardware_concurrency；向上取整到 2 的幂
+    explicit ShardedCounter(std::size_t shards = 0)
+        : mask_(round_up_pow2(shards ? shards : default_shards()) - 1),
+          slots_(new Slot[mask_ + 1]) {}
+
+    ShardedCounter(const ShardedCounter&) = delete;
+    ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+    void add(std::int64_t n) noexcept {
+        slots_[thread_slot() & mask_].v.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void inc() noexcept { add(1); }
+    void dec() noexcept { add(-1); }
+
+    std::int64_t value() const noexcept {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            sum += slots_[i].v.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    // 与并发 add 同时调用时，正在进行的增量可能保留也可能被清掉
+    void reset() noexcept {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            slots_[i].v.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t shard_count() const noexcept { return mask_ + 1; }
+
+private:
+    struct alignas(kCacheLine) Slot {
+        std::atomic<std::int64_t> v{0};
+    };
+
+    static std::size_t default_shards() noexcept {
+        auto n = std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+
+    static std::size_t round_up_pow2(std::size_t n) noexcept {
+        std::size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    // 所有 ShardedCounter 共用同一套线程编号：同一线程在每个计数器里都落在同一分片
+    static std::size_t thread_slot() noexcept {
+        static std::atomic<std::size_t> next{0};
+        thread_local std::size_t slot = next.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+};
+
+} // namespace day9